@@ -3,10 +3,23 @@ IdealReactorProperties properties("");
 
 Thermo thermo(properties.thermo());
 
+thermo.p(properties.p());
+
 Transport transport(properties.transport(), thermo);
 
 Chemistry chemistry(properties.chemistry(), thermo);
 
+//- Optional tabulation of kf and Keq (rateTable dictionary)
+if (properties.rateTableTmax() > 0)
+{
+    chemistry.tabulate
+    (
+        properties.rateTableTmin(),
+        properties.rateTableTmax(),
+        properties.rateTableTolerance()
+    );
+}
+
 //- Insert species word list to the Transport object
 transport.insertChemistrySpecies(chemistry.species());
 
@@ -23,3 +36,92 @@ if (properties.interprete())
 
 //- Create Time object
 Time time(properties.dict());
+
+//- Reactor, initial state and the stiff ODE solver; the Rosenbrock method
+//  needs the exact Jacobian
+HomogeneousReactor reactor
+(
+    chemistry,
+    properties.p(),
+    properties.odeSolver() == "Rodas3"
+);
+
+const word inputMode = properties.inputMode();
+
+const map<word, scalar>& composition =
+    inputMode == "mole" ? properties.X()
+  : inputMode == "mass" ? properties.Y()
+  : properties.C();
+
+scalarField y = reactor.state(properties.T(), composition, inputMode);
+
+//- Optional QSSA: the QSS species are given or selected by their lifetime
+//  at the initial state (the species of the initial composition and the
+//  inert species are kept); the reduced reactor integrates the others
+ChemistryQSSA qssa(chemistry, properties.qssSpecies());
+
+if (properties.qssLifetime() > 0)
+{
+    wordList keep{properties.inertSpecies()};
+
+    loopMapConst(s, value, composition)
+    {
+        keep.push_back(s);
+    }
+
+    scalarField c;
+    reactor.concentrations(y, c);
+
+    qssa.select(properties.T(), c, properties.qssLifetime(), keep);
+}
+
+QSSAHomogeneousReactor qssaReactor(chemistry, qssa, properties.p());
+
+const bool useQSSA = !qssa.qss().empty();
+
+const ODESystem& system =
+    useQSSA
+  ? static_cast<const ODESystem&>(qssaReactor)
+  : static_cast<const ODESystem&>(reactor);
+
+if (useQSSA)
+{
+    Info<< " c-o QSS species:";
+
+    forAll(qssa.qssSpecies(), s)
+    {
+        Info<< " " << s;
+    }
+
+    Info<< "\n" << endl;
+
+    y = qssaReactor.state(y);
+}
+
+smartPtr<ODESolver> solver =
+    ODESolver::New
+    (
+        properties.odeSolver(),
+        system,
+        properties.relTol(),
+        properties.absTol()
+    );
+
+//- Step size of the ODE solver, kept over the kinetic time steps
+scalar dtSolver = time.dTKinetic();
+
+//- Ignition events: the maximum of dT/dt (sign change of its slope) and,
+//  if given, the ignition temperature; terminal if stopAtIgnition is set
+const int dTdtEvent =
+    time.addEvent("max dT/dt", -1, properties.stopAtIgnition());
+
+const int TEvent =
+    properties.ignitionTemperature() > 0
+  ? time.addEvent("T > Tign", 1, properties.stopAtIgnition())
+  : -1;
+
+scalarField dydt(y.size());
+
+system.derivatives(time.runTime(), y, dydt);
+
+scalar dTdtOld = dydt.back();
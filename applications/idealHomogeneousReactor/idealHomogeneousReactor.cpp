@@ -24,6 +24,21 @@ License
 Description
 
     Transient thermo-kinetic 0D calculator for detailed chemistry analysis.
+    The adiabatic reactor at constant pressure (see HomogeneousReactor) is
+    integrated with a stiff ODE solver (odeSolver, relTol and absTol in the
+    dictionary). The time steps follow the step size control of the solver
+    (limited by maxDeltaT) and hit the write times exactly, where the state
+    is reported. The ignition is detected as the maximum of dT/dt and, if
+    ignitionTemperature is given, as the time this temperature is reached;
+    with stopAtIgnition the calculation ends there.
+
+    With qssSpecies (list of species) or qssLifetime (species with a
+    shorter chemical lifetime at the initial state [s]) the reactor is
+    reduced by the quasi-steady-state approximation (see
+    QSSAHomogeneousReactor).
+
+    A rateTable dictionary (Tmin, Tmax and tolerance of ln(k)) tabulates
+    kf and Keq for the reactor pressure (see RateTable).
 
 
 \*---------------------------------------------------------------------------*/
@@ -35,6 +50,9 @@ Description
 #include "chemistry.hpp"
 #include "interpreter.hpp"
 #include "time.hpp"
+#include "homogeneousReactor.hpp"
+#include "qssaHomogeneousReactor.hpp"
+#include "odeSolver.hpp"
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -50,15 +68,72 @@ int main(int argc, char** argv)
 
     #include "createThermoKinetic.hpp"
 
-    Info<< time.endTime() << endl;
-    Info<< time.dTKinetic() << endl;
-    //- Solve kinetics until the end time is reached
+    //- Solve kinetics until the end time or a terminal event is reached
     while (time.loop())
     {
-        Info<< "Time = " << time.runTime() << endl;
+        const scalar t0 = time.runTime();
+
+        //- Increment time, clipped to the write and end times
+        time += time.deltaT();
+
+        //- Integrate the reactor with internal, error controlled steps
+        solver->solve(t0, time.runTime(), y, dtSolver);
+
+        //- The error control of the solver proposes the next time step
+        time.adjustDeltaT(dtSolver);
+
+        //- Ignition events
+        system.derivatives(time.runTime(), y, dydt);
+
+        if (TEvent >= 0)
+        {
+            time.updateEvent
+            (
+                TEvent,
+                y.back() - properties.ignitionTemperature()
+            );
+        }
+
+        time.updateEvent
+        (
+            dTdtEvent,
+            (dydt.back() - dTdtOld)/(time.runTime() - t0)
+        );
+
+        dTdtOld = dydt.back();
+
+        if (time.write())
+        {
+            Info<< "Time = " << time.runTime() << "  T = " << y.back() << endl;
+        }
+    }
+
+    for (int i = 0; i < time.nEvents(); ++i)
+    {
+        if (time.eventTriggered(i))
+        {
+            Info<< "\n c-o Ignition (" << time.eventName(i) << ") at t = "
+                << time.eventTime(i);
+        }
+    }
+
+    if (time.runTime() < time.endTime())
+    {
+        Info<< "\n c-o Stopped at t = " << time.runTime() << "  T = "
+            << y.back();
+    }
+
+    Info<< "\n" << endl;
+
+    //- Reuse statistics of the Jacobian and the decomposition
+    {
+        const JacobianManager& jm = solver->jacobianManager();
 
-        //- Increment time based on kinetic time step
-        time += time.dTKinetic();
+        Info<< " c-o Jacobian evaluations: " << jm.nJacobian()
+            << " (reused in " << jm.nJacobianReuse() << " steps)"
+            << "\n c-o LU decompositions: " << jm.nLU()
+            << " (reused " << jm.nLUReuse() << " times)"
+            << "\n c-o Back-substitutions: " << jm.nSolve() << "\n" << endl;
     }
 
     Footer(startTime);
@@ -0,0 +1,134 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Creator.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Description
+
+    Checks that the source terms evaluated concurrently by the threads of a
+    ChemistryDriver (thread local thermo table, shared PLOG resolution) are
+    identical to the serial evaluation. Returns 1 if any state differs.
+
+    Usage: testChemistryThreads <thermo> <chemistry> [nThreads]
+
+
+\*---------------------------------------------------------------------------*/
+
+#include "definitions.hpp"
+#include "thermo.hpp"
+#include "chemistry.hpp"
+#include "chemistryDriver.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+using namespace TKC;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char** argv)
+{
+    const std::clock_t startTime = clock();
+
+    Info<< Header() << endl;
+
+    if (argc < 3 || argc > 4)
+    {
+        ErrorMsg
+        (
+            "    Usage: testChemistryThreads <thermo> <chemistry> [nThreads]",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    const int nThreads = (argc == 4 ? std::stoi(argv[3]) : 8);
+
+    Thermo thermo(argv[1]);
+    thermo.p(101325);
+
+    Chemistry chemistry(argv[2], thermo);
+
+    const int nSpecies = chemistry.species().size();
+
+    //- States spread over the temperature range of the thermo table
+    const int N = 8000;
+
+    scalarField T(N);
+    List<scalarField> c(N, scalarField(nSpecies));
+
+    forEach(T, n)
+    {
+        T[n] = 900 + (n % 97)*13.7;
+
+        forEach(c[n], s)
+        {
+            c[n][s] = 1e-7*(1 + ((n*7 + s*13) % 17));
+        }
+    }
+
+    //- Serial reference
+    List<scalarField> omegaSerial(N, scalarField(nSpecies));
+
+    forEach(T, n)
+    {
+        chemistry.omega(T[n], c[n], omegaSerial[n]);
+    }
+
+    //- Concurrent evaluation, repeated to provoke races
+    ChemistryDriver driver(chemistry, nThreads, 16);
+
+    List<scalarField> omegaThreads(N, scalarField(nSpecies));
+
+    const int nRepeat = 10;
+    int nDiffer = 0;
+
+    for (int i = 0; i < nRepeat; ++i)
+    {
+        driver.run
+        (
+            N,
+            [&](ChemistryWorkspace&, const int begin, const int end)
+            {
+                for (int n = begin; n < end; ++n)
+                {
+                    chemistry.omega(T[n], c[n], omegaThreads[n]);
+                }
+            }
+        );
+
+        forEach(T, n)
+        {
+            if (omegaThreads[n] != omegaSerial[n])
+            {
+                ++nDiffer;
+            }
+        }
+    }
+
+    Info<< " c-o States differing (threaded vs. serial): " << nDiffer
+        << " of " << nRepeat*N << "\n" << endl;
+
+    Footer(startTime);
+
+    return (nDiffer == 0 ? 0 : 1);
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,167 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Creator.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Description
+
+    Checks the equilibrium constants Kc [(mol/cm^3)^dn] of all reversible
+    reactions against values computed independently out of the NASA
+    polynomials and the stoichiometry of the reader
+
+        Kc = exp(-sum_s nu_s g0_s/(RT)) (p0/(RT))^dn
+
+    with p0 = 1e5 Pa and R = 8.314e6 cm^3 Pa/(mol K). Both the single
+    reaction keq(r, T) and the batched keq(T, K) are checked, the latter
+    also at a different pressure as Kc does not depend on p. Returns 1 if
+    the relative error exceeds the tolerance.
+
+    Usage: testEquilibriumConstant <thermo> <chemistry> [T]
+
+
+\*---------------------------------------------------------------------------*/
+
+#include "definitions.hpp"
+#include "thermo.hpp"
+#include "chemistry.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+using namespace TKC;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+//- g0/(RT) of the species out of the NASA polynomials
+scalar gRT(const Thermo& thermo, const word& species, const scalar T)
+{
+    const scalarField coeffs = thermo.getCoeffs(species, T);
+
+    return
+        coeffs[0]*(1 - log(T))
+      - coeffs[1]*T/2
+      - coeffs[2]*T*T/6
+      - coeffs[3]*T*T*T/12
+      - coeffs[4]*T*T*T*T/20
+      + coeffs[5]/T
+      - coeffs[6];
+}
+
+
+int main(int argc, char** argv)
+{
+    const std::clock_t startTime = clock();
+
+    Info<< Header() << endl;
+
+    if (argc < 3 || argc > 4)
+    {
+        ErrorMsg
+        (
+            "    Usage: testEquilibriumConstant <thermo> <chemistry> [T]",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    const scalar T = (argc == 4 ? std::stod(argv[3]) : 2000);
+
+    Thermo thermo(argv[1]);
+    thermo.p(101325);
+
+    Chemistry chemistry(argv[2], thermo);
+
+    //- Batched values at two pressures
+    scalarField K1;
+    chemistry.keq(T, K1);
+
+    thermo.p(1e7);
+    Chemistry chemistryHP(argv[2], thermo);
+
+    scalarField K2;
+    chemistryHP.keq(T, K2);
+
+    //- Independent Kc
+    const scalar R = 8.314459848e6;
+    const scalar p0 = 1e5;
+
+    const scalar tolerance =
+        sqrt(std::numeric_limits<scalar>::epsilon());
+
+    scalar maxError{0};
+    int nChecked{0};
+    int nDn{0};
+
+    for (int r = 0; r < chemistry.nReac(); ++r)
+    {
+        if (!chemistry.backwardReaction(r))
+        {
+            continue;
+        }
+
+        scalar dgRT{0};
+        scalar dn{0};
+
+        //- Stoichiometric factors of the educts are stored negative
+        for (const auto& [species, nu] : chemistry.nuEducts(r))
+        {
+            dgRT += nu*gRT(thermo, species, T);
+            dn += nu;
+        }
+
+        for (const auto& [species, nu] : chemistry.nuProducts(r))
+        {
+            dgRT += nu*gRT(thermo, species, T);
+            dn += nu;
+        }
+
+        const scalar Kc = exp(-dgRT)*pow(p0/(R*T), dn);
+
+        const scalar error =
+            max
+            (
+                abs(chemistry.keq(r, T) - Kc),
+                max(abs(K1[r] - Kc), abs(K2[r] - Kc))
+            )/Kc;
+
+        if (dn != 0)
+        {
+            Info<< " c-o " << chemistry.elementarReaction(r)
+                << ": Kc " << Kc << ", keq " << chemistry.keq(r, T)
+                << ", dn " << dn << endl;
+
+            ++nDn;
+        }
+
+        maxError = max(maxError, error);
+        ++nChecked;
+    }
+
+    Info<< "\n c-o Reversible reactions checked at T = " << T << ": "
+        << nChecked << " (" << nDn << " with dn != 0)"
+        << "\n c-o Maximum relative error " << maxError << ", tolerance "
+        << tolerance << "\n" << endl;
+
+    Footer(startTime);
+
+    return (maxError <= tolerance && nDn > 0 ? 0 : 1);
+}
+
+
+// ************************************************************************* //
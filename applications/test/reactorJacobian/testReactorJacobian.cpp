@@ -0,0 +1,178 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Creator.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Description
+
+    Checks the exact Jacobian of the HomogeneousReactor against central
+    finite differences of the derivatives for a state with all species
+    present (equal mole fractions). The error of each entry is measured
+    relative to the entry itself, bounded below by a fraction of the
+    largest entry of its row (round-off of the finite differences). The
+    step and the tolerance follow from the machine epsilon of the scalar
+    type, hence the test holds for all precisions. Returns 1 if the error
+    exceeds the tolerance.
+
+    Usage: testReactorJacobian <thermo> <chemistry> [T]
+
+
+\*---------------------------------------------------------------------------*/
+
+#include "definitions.hpp"
+#include "thermo.hpp"
+#include "chemistry.hpp"
+#include "homogeneousReactor.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+using namespace TKC;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char** argv)
+{
+    const std::clock_t startTime = clock();
+
+    Info<< Header() << endl;
+
+    if (argc < 3 || argc > 4)
+    {
+        ErrorMsg
+        (
+            "    Usage: testReactorJacobian <thermo> <chemistry> [T]",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    const scalar T = (argc == 4 ? std::stod(argv[3]) : 1500);
+    const scalar p = 101325;
+
+    Thermo thermo(argv[1]);
+    thermo.p(p);
+
+    Chemistry chemistry(argv[2], thermo);
+
+    HomogeneousReactor reactor(chemistry, p, true);
+
+    map<word, scalar> composition;
+
+    forAll(chemistry.species(), species)
+    {
+        composition[species] = 1;
+    }
+
+    const scalarField y = reactor.state(T, composition, "mole");
+
+    const int n = reactor.nEqns();
+
+    //- Analytical Jacobian
+    SparseMatrix J = reactor.jacobianStructure();
+    scalarField dydt(n);
+
+    reactor.jacobian(0, y, dydt, J);
+
+    //- Central finite differences, column by column; the step balances
+    //  the truncation error (h^2) and the round-off error (eps/h)
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+    const scalar delta = cbrt(eps);
+
+    List<scalarField> Jfd(n, scalarField(n, 0));
+
+    scalarField yp(y);
+    scalarField ym(y);
+    scalarField dydtp(n);
+    scalarField dydtm(n);
+
+    for (int j = 0; j < n; ++j)
+    {
+        const scalar h = delta*max(abs(y[j]), scalar(1e-3));
+
+        yp[j] = y[j] + h;
+        ym[j] = y[j] - h;
+
+        reactor.derivatives(0, yp, dydtp);
+        reactor.derivatives(0, ym, dydtm);
+
+        for (int i = 0; i < n; ++i)
+        {
+            Jfd[i][j] = (dydtp[i] - dydtm[i])/(2*h);
+        }
+
+        yp[j] = y[j];
+        ym[j] = y[j];
+    }
+
+    //- Error relative to the entry, entries below sqrt(eps) of the
+    //  largest entry of the row are compared to the latter. The error of
+    //  the finite differences is of the order delta^2 = eps^(2/3), times
+    //  the cancellation of the forward and backward rates; the tolerance
+    //  delta leaves room for the latter and still detects missing terms
+    const scalar tolerance = delta;
+    const scalar floor = sqrt(eps);
+
+    scalar maxError{0};
+    int iMax{0};
+    int jMax{0};
+
+    for (int i = 0; i < n; ++i)
+    {
+        scalar rowMax{0};
+
+        for (int j = 0; j < n; ++j)
+        {
+            rowMax = max(rowMax, abs(Jfd[i][j]));
+        }
+
+        if (rowMax == 0)
+        {
+            continue;
+        }
+
+        for (int j = 0; j < n; ++j)
+        {
+            const scalar Jij = (J.find(i, j) >= 0 ? J(i, j) : scalar(0));
+            const scalar error =
+                abs(Jij - Jfd[i][j])
+               /max(abs(Jfd[i][j]), floor*rowMax);
+
+            if (error > maxError)
+            {
+                maxError = error;
+                iMax = i;
+                jMax = j;
+            }
+        }
+    }
+
+    Info<< " c-o d(dT/dt)/dT: analytical " << J(n-1, n-1)
+        << ", finite differences " << Jfd[n-1][n-1]
+        << "\n c-o Maximum relative error " << maxError
+        << " at (" << iMax << ", " << jMax << "), tolerance "
+        << tolerance << "\n" << endl;
+
+    Footer(startTime);
+
+    return (maxError <= tolerance ? 0 : 1);
+}
+
+
+// ************************************************************************* //
@@ -54,7 +54,17 @@ using ostream = std::ostream;
 
 using fstream = std::fstream;
 
+//- Floating point precision, selected with PRECISION in .compilerFlags
+#if defined(TKC_PRECISION_FLOAT)
+using scalar = float;
+#elif defined(TKC_PRECISION_DOUBLE)
+using scalar = double;
+#else
 using scalar = long double;
+#endif
+
+//- Precision for ill conditioned operations (e.g. fitting procedures)
+using highScalar = long double;
 
 using boolList = std::vector<bool>;
 
@@ -137,6 +147,22 @@ T max(const T tmp1, const T tmp2
     return std::max(tmp1, tmp2);
 }
 
+
+//- Integer power x^n (n >= 0) by multiplications, e.g. stochiometric
+//  exponents of the mass action law (no pow())
+template <typename T>
+T integerPow(const T x, const int n)
+{
+    T result{1};
+
+    for (int i = 0; i < n; ++i)
+    {
+        result *= x;
+    }
+
+    return result;
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
 } // End namespace TKC
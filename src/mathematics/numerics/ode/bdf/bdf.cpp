@@ -0,0 +1,490 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "bdf.hpp"
+#include <math.h>
+#include <limits>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::BDF::BDF
+(
+    const ODESystem& odes,
+    const scalar relTol,
+    const scalar absTol
+)
+:
+    ODESolver(odes, relTol, absTol),
+    gamma_(maxOrder_+2, 0),
+    alpha_(maxOrder_+2, 0),
+    errorConst_(maxOrder_+2, 0),
+    f_(n_),
+    y_(n_),
+    yPredict_(n_),
+    psi_(n_),
+    d_(n_),
+    dy_(n_),
+    scale_(n_),
+    error_(n_),
+    D_(maxOrder_+3, scalarField(n_, 0))
+{
+    //- gamma_k = sum_{i=1}^{k} 1/i, error constant 1/(k+1)
+    for (int k = 1; k < maxOrder_+2; ++k)
+    {
+        gamma_[k] = gamma_[k-1] + scalar(1)/k;
+    }
+
+    for (int k = 0; k < maxOrder_+2; ++k)
+    {
+        alpha_[k] = gamma_[k];
+        errorConst_[k] = scalar(1)/(k+1);
+    }
+
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+
+    newtonTol_ = max(10*eps/relTol_, min(scalar(0.03), sqrt(relTol_)));
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::BDF::~BDF()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::BDF::solve
+(
+    const scalar t0,
+    const scalar tEnd,
+    scalarField& y,
+    scalar& dtTry
+)
+{
+    //- Continue with the history if the state was not changed
+    if (!started_ || t0 != t_ || y != D_[0])
+    {
+        start(t0, y, dtTry);
+    }
+
+    while (t_ < tEnd)
+    {
+        step(tEnd);
+    }
+
+    y = D_[0];
+    dtTry = h_;
+}
+
+
+void TKC::BDF::start(const scalar t, const scalarField& y, const scalar h)
+{
+    if (h <= 0)
+    {
+        ErrorMsg
+        (
+            "The initial step size of the BDF solver has to be positive",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    t_ = t;
+    h_ = h;
+    order_ = 1;
+    nEqualSteps_ = 0;
+
+    forAll(D_, Di)
+    {
+        std::fill(Di.begin(), Di.end(), 0);
+    }
+
+    //- Fresh Jacobian for the new state
+    jacobian_.update(t, y, f_);
+
+    D_[0] = y;
+
+    for (int i = 0; i < n_; ++i)
+    {
+        D_[1][i] = f_[i]*h;
+    }
+
+    started_ = true;
+}
+
+
+void TKC::BDF::step(const scalar tEnd)
+{
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+
+    const scalar minStep = 10*eps*max(fabs(t_), scalar(1e-300));
+
+    scalar errorNorm{0};
+    scalar safety{0};
+
+    //- Renew an old Jacobian or one that converged slowly
+    if (jacobian_.needUpdate())
+    {
+        jacobian_.update(t_, D_[0], f_);
+    }
+
+    bool accepted{false};
+
+    while (!accepted)
+    {
+        if (h_ < minStep)
+        {
+            ErrorMsg
+            (
+                "The step size of the BDF solver is too small at t = "
+                + std::to_string(t_),
+                __FILE__,
+                __LINE__
+            );
+        }
+
+        scalar tNew = t_ + h_;
+
+        //- Hit the end time exactly
+        if (tNew > tEnd)
+        {
+            tNew = tEnd;
+            changeD((tNew - t_)/h_);
+            h_ = tNew - t_;
+            nEqualSteps_ = 0;
+        }
+
+        //- Predictor and the known part of the corrector
+        for (int i = 0; i < n_; ++i)
+        {
+            scalar yp{0};
+            scalar psi{0};
+
+            for (int k = 0; k <= order_; ++k)
+            {
+                yp += D_[k][i];
+            }
+
+            for (int k = 1; k <= order_; ++k)
+            {
+                psi += gamma_[k]*D_[k][i];
+            }
+
+            yPredict_[i] = yp;
+            psi_[i] = psi / alpha_[order_];
+        }
+
+        errorScale(yPredict_, scale_);
+
+        const scalar c = h_ / alpha_[order_];
+
+        int nIter{0};
+        bool converged{false};
+
+        jacobian_.prepare(c);
+
+        while (!converged)
+        {
+            converged = newton(tNew, c, nIter);
+
+            if (!converged)
+            {
+                //- Renew the Jacobian, then the decomposition for the
+                //  exact c, then reduce the step size
+                if (!jacobian_.current())
+                {
+                    jacobian_.update(tNew, yPredict_, f_);
+                    jacobian_.factorize(c);
+                }
+                else if (jacobian_.c() != c)
+                {
+                    jacobian_.factorize(c);
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        if (!converged)
+        {
+            h_ *= 0.5;
+            changeD(0.5);
+            nEqualSteps_ = 0;
+
+            continue;
+        }
+
+        safety =
+            0.9*(2*maxNewtonIter_ + 1)/scalar(2*maxNewtonIter_ + nIter);
+
+        errorScale(y_, scale_);
+
+        for (int i = 0; i < n_; ++i)
+        {
+            error_[i] = errorConst_[order_]*d_[i];
+        }
+
+        errorNorm = norm(error_, scale_);
+
+        if (errorNorm > 1)
+        {
+            const scalar factor =
+                max
+                (
+                    scalar(0.2),
+                    safety*pow(errorNorm, scalar(-1)/(order_ + 1))
+                );
+
+            h_ *= factor;
+            changeD(factor);
+            nEqualSteps_ = 0;
+        }
+        else
+        {
+            accepted = true;
+        }
+    }
+
+    //- Accept the step and update the differences
+    jacobian_.step();
+
+    ++nEqualSteps_;
+
+    t_ += h_;
+
+    for (int i = 0; i < n_; ++i)
+    {
+        D_[order_+2][i] = d_[i] - D_[order_+1][i];
+        D_[order_+1][i] = d_[i];
+    }
+
+    for (int k = order_; k >= 0; --k)
+    {
+        for (int i = 0; i < n_; ++i)
+        {
+            D_[k][i] += D_[k+1][i];
+        }
+    }
+
+    //- The end time is hit exactly
+    if (t_ > tEnd - minStep)
+    {
+        t_ = tEnd;
+    }
+
+    if (nEqualSteps_ < order_ + 1)
+    {
+        return;
+    }
+
+    //- Order selection out of the error estimates of k-1, k and k+1
+    const scalar great = std::numeric_limits<scalar>::max();
+
+    scalar errorM{great};
+    scalar errorP{great};
+
+    if (order_ > 1)
+    {
+        for (int i = 0; i < n_; ++i)
+        {
+            error_[i] = errorConst_[order_-1]*D_[order_][i];
+        }
+
+        errorM = norm(error_, scale_);
+    }
+
+    if (order_ < maxOrder_)
+    {
+        for (int i = 0; i < n_; ++i)
+        {
+            error_[i] = errorConst_[order_+1]*D_[order_+2][i];
+        }
+
+        errorP = norm(error_, scale_);
+    }
+
+    const scalar factorM = pow(errorM, scalar(-1)/order_);
+    const scalar factor0 = pow(errorNorm, scalar(-1)/(order_ + 1));
+    const scalar factorP = pow(errorP, scalar(-1)/(order_ + 2));
+
+    scalar factor = factor0;
+
+    if (factorM > factor && factorM >= factorP)
+    {
+        factor = factorM;
+        --order_;
+    }
+    else if (factorP > factor)
+    {
+        factor = factorP;
+        ++order_;
+    }
+
+    factor = min(scalar(10), safety*factor);
+
+    h_ *= factor;
+    changeD(factor);
+    nEqualSteps_ = 0;
+}
+
+
+bool TKC::BDF::newton(const scalar t, const scalar c, int& nIter)
+{
+    y_ = yPredict_;
+
+    std::fill(d_.begin(), d_.end(), 0);
+
+    scalar dyNormOld{-1};
+
+    for (int k = 0; k < maxNewtonIter_; ++k)
+    {
+        nIter = k + 1;
+
+        odes_.derivatives(t, y_, f_);
+
+        for (int i = 0; i < n_; ++i)
+        {
+            if (!std::isfinite(f_[i]))
+            {
+                return false;
+            }
+
+            dy_[i] = c*f_[i] - psi_[i] - d_[i];
+        }
+
+        jacobian_.solve(dy_);
+
+        const scalar dyNorm = norm(dy_, scale_);
+
+        //- Convergence rate, diverging or too slow
+        scalar rate{-1};
+
+        if (dyNormOld > 0)
+        {
+            rate = dyNorm / dyNormOld;
+
+            if
+            (
+                rate >= 1
+             || pow(rate, maxNewtonIter_ - k)/(1 - rate)*dyNorm > newtonTol_
+            )
+            {
+                return false;
+            }
+        }
+
+        for (int i = 0; i < n_; ++i)
+        {
+            y_[i] += dy_[i];
+            d_[i] += dy_[i];
+        }
+
+        if (dyNorm == 0 || (rate >= 0 && rate/(1 - rate)*dyNorm < newtonTol_))
+        {
+            jacobian_.converged(rate);
+
+            return true;
+        }
+
+        dyNormOld = dyNorm;
+    }
+
+    return false;
+}
+
+
+void TKC::BDF::changeD(const scalar factor)
+{
+    const int n = order_ + 1;
+
+    //- R(factor) U with U = R(1), R_ij = prod_{k<=i} (k-1-factor j)/k
+    auto R = [n](const scalar f)
+    {
+        List<scalarField> r(n, scalarField(n, 1));
+
+        for (int i = 1; i < n; ++i)
+        {
+            r[i][0] = 0;
+
+            for (int j = 1; j < n; ++j)
+            {
+                r[i][j] = r[i-1][j]*(i - 1 - f*j)/i;
+            }
+        }
+
+        return r;
+    };
+
+    const List<scalarField> Rf = R(factor);
+    const List<scalarField> U = R(1);
+
+    List<scalarField> RU(n, scalarField(n, 0));
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                RU[i][j] += Rf[i][k]*U[k][j];
+            }
+        }
+    }
+
+    //- D_i <- sum_j RU_ji D_j
+    List<scalarField> Dnew(n, scalarField(n_, 0));
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            const scalar a = RU[j][i];
+
+            for (int m = 0; m < n_; ++m)
+            {
+                Dnew[i][m] += a*D_[j][m];
+            }
+        }
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        D_[i] = Dnew[i];
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::BDF::order() const
+{
+    return order_;
+}
+
+
+// ************************************************************************* //
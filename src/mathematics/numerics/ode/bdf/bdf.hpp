@@ -0,0 +1,186 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::BDF
+
+Description
+    Variable order (1-5), variable step backward differentiation formulas
+    for stiff ODESystems in the quasi constant step size formulation. The
+    history is stored as modified divided differences D and rescaled when
+    the step size changes [Shampine and Reichelt, The MATLAB ODE Suite,
+    SIAM J. Sci. Comput. 18 (1997)].
+
+    Each step solves the implicit system with a simplified Newton method
+    with the matrix I - h/alpha_k J. The Jacobian and the decomposition are
+    reused over the steps (see JacobianManager):
+
+    + the matrix is factorized again (sparse LU, no new J) only if
+      h/alpha_k changed considerably by the step size or order selection
+    + the Jacobian is evaluated again if the Newton iteration fails or
+      converges slowly with the old one
+    + if even a fresh Jacobian does not converge, the step is halved
+
+    The local error estimate controls the step size; after k+1 steps of
+    equal size the orders k-1, k and k+1 are compared and the one that
+    allows the largest step is used. The last step of each solve() call is
+    shortened to hit tEnd exactly; the history is kept between the calls
+    as long as the state is not changed from outside.
+
+SourceFiles
+    bdf.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef BDF_hpp
+#define BDF_hpp
+
+#include "odeSolver.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                             Class BDF Declaration
+\*---------------------------------------------------------------------------*/
+
+class BDF
+:
+    public ODESolver
+{
+    private:
+
+        // Private Constants
+
+            //- Maximum order
+            static constexpr int maxOrder_{5};
+
+            //- Maximum number of Newton iterations
+            static constexpr int maxNewtonIter_{4};
+
+
+        // Private Data
+
+            //- Coefficients of the formulas (index = order)
+            scalarField gamma_;
+            scalarField alpha_;
+            scalarField errorConst_;
+
+            //- Tolerance of the Newton iteration
+            scalar newtonTol_;
+
+            //- Actual order
+            int order_{1};
+
+            //- Number of steps with the same step size and order
+            int nEqualSteps_{0};
+
+
+        // Workspace
+
+            scalarField f_;
+            scalarField y_;
+            scalarField yPredict_;
+            scalarField psi_;
+            scalarField d_;
+            scalarField dy_;
+            scalarField scale_;
+            scalarField error_;
+
+
+        // Private Member Functions
+
+            //- Simplified Newton iteration at time t for the given c;
+            //  returns true if converged, y_ and d_ hold the solution and
+            //  the correction to the prediction
+            bool newton(const scalar, const scalar, int&);
+
+            //- Rescale the differences for a new step size h*factor
+            void changeD(const scalar);
+
+
+    protected:
+
+        // Protected Data
+
+            //- Modified divided differences (maxOrder + 3 rows)
+            List<scalarField> D_;
+
+            //- Time of the history
+            scalar t_{0};
+
+            //- Actual step size
+            scalar h_{0};
+
+            //- History is initialized
+            bool started_{false};
+
+
+        // Protected Member Functions
+
+            //- Initialize the history for the state y at time t
+            void start(const scalar, const scalarField&, const scalar);
+
+            //- Do one accepted step (not beyond tEnd)
+            void step(const scalar);
+
+
+    public:
+
+        //- Constructor
+        BDF(const ODESystem&, const scalar, const scalar);
+
+        //- Destructor
+        ~BDF();
+
+
+        // Member Functions
+
+            //- Integrate the state y from t0 to tEnd
+            void solve
+            (
+                const scalar,
+                const scalar,
+                scalarField&,
+                scalar&
+            );
+
+
+        // Return Functions
+
+            //- Return the actual order
+            int order() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // BDF_hpp included
+
+// ************************************************************************* //
@@ -0,0 +1,273 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "jacobianManager.hpp"
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::JacobianManager::JacobianManager(const ODESystem& odes)
+:
+    odes_(odes),
+    J_(odes.jacobianStructure()),
+    M_(odes.jacobianStructure()),
+    diag_(odes.nEqns())
+{
+    forEach(diag_, i)
+    {
+        diag_[i] = J_.find(i, i);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::JacobianManager::~JacobianManager()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool TKC::JacobianManager::needUpdate() const
+{
+    return !valid_ || age_ >= maxAge_;
+}
+
+
+void TKC::JacobianManager::update
+(
+    const scalar t,
+    const scalarField& y,
+    scalarField& f
+)
+{
+    odes_.jacobian(t, y, f, J_);
+
+    ++nJacobian_;
+
+    valid_ = true;
+    current_ = true;
+    luValid_ = false;
+    age_ = 0;
+}
+
+
+void TKC::JacobianManager::prepare(const scalar c)
+{
+    cRequest_ = c;
+
+    if (luValid_ && fabs(c/c_ - 1) <= maxRatio_)
+    {
+        ++nLUReuse_;
+
+        return;
+    }
+
+    factorize(c);
+}
+
+
+void TKC::JacobianManager::factorize(const scalar c)
+{
+    if (!valid_)
+    {
+        ErrorMsg
+        (
+            "The Jacobian has to be evaluated before the decomposition",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    cRequest_ = c;
+
+    const scalarField& J = J_.values();
+    scalarField& M = M_.values();
+
+    forEach(M, i)
+    {
+        M[i] = -c*J[i];
+    }
+
+    forAll(diag_, d)
+    {
+        M[d] += 1;
+    }
+
+    M_.LU();
+
+    ++nLU_;
+
+    c_ = c;
+    luValid_ = true;
+}
+
+
+void TKC::JacobianManager::solve(scalarField& b)
+{
+    M_.solve(b);
+
+    ++nSolve_;
+}
+
+
+void TKC::JacobianManager::converged(const scalar rate)
+{
+    //- Slow with the decomposition of another c, renew it for the next step
+    if (rate > slowRate_ && c_ != cRequest_)
+    {
+        luValid_ = false;
+    }
+}
+
+
+void TKC::JacobianManager::step()
+{
+    if (!current_)
+    {
+        ++nJacobianReuse_;
+    }
+
+    current_ = false;
+
+    ++age_;
+}
+
+
+TKC::scalar TKC::JacobianManager::spectralRadius(const int nIter) const
+{
+    if (!valid_)
+    {
+        ErrorMsg
+        (
+            "The Jacobian has to be evaluated before its spectral radius",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    //- Start vector that is not orthogonal to any eigenvector in general
+    scalarField x(diag_.size());
+    scalarField Jx(diag_.size());
+
+    forEach(x, i)
+    {
+        x[i] = 1 + scalar(i)/x.size();
+    }
+
+    auto length = [](const scalarField& v)
+    {
+        scalar sum{0};
+
+        forAll(v, vi)
+        {
+            sum += vi*vi;
+        }
+
+        return sqrt(sum);
+    };
+
+    scalar lx = length(x);
+    scalar radius{0};
+
+    for (int k = 0; k < nIter; ++k)
+    {
+        J_.multiply(x, Jx);
+
+        const scalar lJx = length(Jx);
+
+        if (lJx == 0)
+        {
+            return 0;
+        }
+
+        radius = lJx / lx;
+
+        forEach(x, i)
+        {
+            x[i] = Jx[i] / lJx;
+        }
+
+        lx = 1;
+    }
+
+    return radius;
+}
+
+
+void TKC::JacobianManager::reset()
+{
+    valid_ = false;
+    current_ = false;
+    luValid_ = false;
+    age_ = 0;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+bool TKC::JacobianManager::current() const
+{
+    return current_;
+}
+
+
+TKC::scalar TKC::JacobianManager::c() const
+{
+    return c_;
+}
+
+
+int TKC::JacobianManager::nJacobian() const
+{
+    return nJacobian_;
+}
+
+
+int TKC::JacobianManager::nJacobianReuse() const
+{
+    return nJacobianReuse_;
+}
+
+
+int TKC::JacobianManager::nLU() const
+{
+    return nLU_;
+}
+
+
+int TKC::JacobianManager::nLUReuse() const
+{
+    return nLUReuse_;
+}
+
+
+int TKC::JacobianManager::nSolve() const
+{
+    return nSolve_;
+}
+
+
+// ************************************************************************* //
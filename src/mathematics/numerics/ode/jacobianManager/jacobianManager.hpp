@@ -0,0 +1,200 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+
+Class
+    TKC::JacobianManager
+
+Description
+    Keeps the Jacobian J of an ODESystem and the decomposed iteration
+    matrix M = I - c J of the implicit solvers and decides when they have
+    to be renewed. The Jacobian changes slowly along the solution, hence
+    both are reused over steps and Newton iterations:
+
+    + M is decomposed again only if c differs by more than maxRatio from
+      the c of the decomposition, if J was renewed or if the last Newton
+      iteration with an M of another c converged slowly (rate > slowRate)
+    + J is evaluated again after a failed Newton iteration (decided by the
+      solver) and after maxAge steps
+
+    The magnitude of the dominant eigenvalue of J is estimated with a power
+    iteration (spectralRadius); it measures the stiffness of the system.
+
+    The counters give the number of evaluations, decompositions and
+    back-substitutions as well as how often J and M were reused; they are
+    accumulated over the lifetime of the solver.
+
+SourceFiles
+    jacobianManager.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef JacobianManager_hpp
+#define JacobianManager_hpp
+
+#include "definitions.hpp"
+#include "odeSystem.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                       Class JacobianManager Declaration
+\*---------------------------------------------------------------------------*/
+
+class JacobianManager
+{
+    private:
+
+        // Private Constants
+
+            //- Maximum relative change of c for reusing the decomposition
+            static constexpr scalar maxRatio_{0.3};
+
+            //- Convergence rate above which M is renewed for the actual c
+            static constexpr scalar slowRate_{0.5};
+
+            //- Maximum number of steps with the same Jacobian
+            static constexpr int maxAge_{100};
+
+
+        // Private Data
+
+            //- Reference to the system of ODEs
+            const ODESystem& odes_;
+
+            //- Jacobian and iteration matrix I - c J (same structure)
+            SparseMatrix J_;
+            SparseMatrix M_;
+
+            //- Position of the diagonal in the values
+            List<int> diag_;
+
+            //- Factor c of the decomposition
+            scalar c_{0};
+
+            //- Factor c of the last request
+            scalar cRequest_{0};
+
+            //- Jacobian is available
+            bool valid_{false};
+
+            //- Jacobian is evaluated within the actual step
+            bool current_{false};
+
+            //- Decomposition belongs to the actual Jacobian
+            bool luValid_{false};
+
+            //- Number of accepted steps since the last evaluation
+            int age_{0};
+
+
+        // Counters
+
+            int nJacobian_{0};
+            int nJacobianReuse_{0};
+            int nLU_{0};
+            int nLUReuse_{0};
+            int nSolve_{0};
+
+
+    public:
+
+        //- Constructor
+        JacobianManager(const ODESystem&);
+
+        //- Destructor
+        ~JacobianManager();
+
+
+        // Member Functions
+
+            //- Return true if the Jacobian has to be evaluated before the
+            //  next step (none yet or too old)
+            bool needUpdate() const;
+
+            //- Evaluate the Jacobian and the derivatives f for the state y
+            //  at time t; the decomposition becomes invalid
+            void update(const scalar, const scalarField&, scalarField&);
+
+            //- Provide the decomposition of I - c J; the old one is reused
+            //  if its c is close enough (see maxRatio)
+            void prepare(const scalar);
+
+            //- Decompose I - c J regardless of the old decomposition
+            void factorize(const scalar);
+
+            //- Solve M x = b in place
+            void solve(scalarField&);
+
+            //- Report the convergence rate of a successful Newton iteration
+            void converged(const scalar);
+
+            //- Report an accepted step
+            void step();
+
+            //- Estimate the magnitude of the dominant eigenvalue of the
+            //  actual Jacobian with nIter power iterations
+            scalar spectralRadius(const int nIter = 20) const;
+
+            //- Forget the Jacobian (e.g. after a change of the state from
+            //  outside); the counters are kept
+            void reset();
+
+
+        // Return Functions
+
+            //- Return true if the Jacobian was evaluated within this step
+            bool current() const;
+
+            //- Return the factor c of the decomposition
+            scalar c() const;
+
+            //- Return the number of Jacobian evaluations
+            int nJacobian() const;
+
+            //- Return the number of steps that reused an old Jacobian
+            int nJacobianReuse() const;
+
+            //- Return the number of decompositions
+            int nLU() const;
+
+            //- Return the number of times an old decomposition was reused
+            int nLUReuse() const;
+
+            //- Return the number of back-substitutions
+            int nSolve() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // JacobianManager_hpp included
+
+// ************************************************************************* //
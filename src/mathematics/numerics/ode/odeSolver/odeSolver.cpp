@@ -0,0 +1,160 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "odeSolver.hpp"
+#include "bdf.hpp"
+#include "rodas3.hpp"
+#include "stiffSwitching.hpp"
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ODESolver::ODESolver
+(
+    const ODESystem& odes,
+    const scalar relTol,
+    const scalar absTol
+)
+:
+    odes_(odes),
+    n_(odes.nEqns()),
+    relTol_(relTol),
+    absTol_(absTol),
+    jacobian_(odes)
+{
+    if (relTol_ <= 0 || absTol_ <= 0)
+    {
+        ErrorMsg
+        (
+            "The tolerances of the ODE solver have to be positive",
+            __FILE__,
+            __LINE__
+        );
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ODESolver::~ODESolver()
+{}
+
+
+// * * * * * * * * * * * * * * * * * Selector  * * * * * * * * * * * * * * * //
+
+TKC::smartPtr<TKC::ODESolver> TKC::ODESolver::New
+(
+    const word name,
+    const ODESystem& odes,
+    const scalar relTol,
+    const scalar absTol
+)
+{
+    if (name == "BDF")
+    {
+        return smartPtr<ODESolver>(new BDF(odes, relTol, absTol));
+    }
+    else if (name == "Rodas3")
+    {
+        return smartPtr<ODESolver>(new Rodas3(odes, relTol, absTol));
+    }
+    else if (name == "StiffSwitching")
+    {
+        return smartPtr<ODESolver>(new StiffSwitching(odes, relTol, absTol));
+    }
+
+    ErrorMsg
+    (
+        "The ODE solver " + name + " is not known, available: BDF, Rodas3, "
+        "StiffSwitching",
+        __FILE__,
+        __LINE__
+    );
+
+    return smartPtr<ODESolver>();
+}
+
+
+// * * * * * * * * * * * * * * Protected Functions  * * * * * * * * * * * * //
+
+TKC::scalar TKC::ODESolver::norm
+(
+    const scalarField& x,
+    const scalarField& scale
+) const
+{
+    scalar sum{0};
+
+    for (int i = 0; i < n_; ++i)
+    {
+        const scalar e = x[i] / scale[i];
+
+        sum += e*e;
+    }
+
+    return sqrt(sum / n_);
+}
+
+
+void TKC::ODESolver::errorScale
+(
+    const scalarField& y,
+    scalarField& scale
+) const
+{
+    for (int i = 0; i < n_; ++i)
+    {
+        scale[i] = absTol_ + relTol_*fabs(y[i]);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::ODESolver::nEqns() const
+{
+    return n_;
+}
+
+
+TKC::scalar TKC::ODESolver::relTol() const
+{
+    return relTol_;
+}
+
+
+TKC::scalar TKC::ODESolver::absTol() const
+{
+    return absTol_;
+}
+
+
+const TKC::JacobianManager& TKC::ODESolver::jacobianManager() const
+{
+    return jacobian_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,157 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ODESolver
+
+Description
+    Abstract base class of the solvers for stiff ODESystems. A solver
+    integrates the state y from t0 to tEnd with internal, error controlled
+    steps. The step size of the last step is returned as estimate for the
+    next call. The solvers are selected by name with ODESolver::New:
+
+    + BDF: variable order (1-5) and variable step backward differentiation
+      formulas with Newton iterations (see BDF)
+    + Rodas3: stiffly accurate Rosenbrock method of order 3(2) with one
+      Jacobian and one factorization per step (see Rodas3); it needs no
+      history and is well suited for short integrations
+    + StiffSwitching: explicit Runge-Kutta 5(4) in the non-stiff parts and
+      BDF in the stiff parts with automatic stiffness detection (see
+      StiffSwitching)
+
+    The error of each step is measured in the RMS norm of
+    error_i / (absTol + relTol |y_i|). The Jacobian and the decomposed
+    iteration matrix are held by a JacobianManager that decides about
+    their reuse and counts the evaluations.
+
+SourceFiles
+    odeSolver.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ODESolver_hpp
+#define ODESolver_hpp
+
+#include "definitions.hpp"
+#include "odeSystem.hpp"
+#include "jacobianManager.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                          Class ODESolver Declaration
+\*---------------------------------------------------------------------------*/
+
+class ODESolver
+{
+    protected:
+
+        // Protected Data
+
+            //- Reference to the system of ODEs
+            const ODESystem& odes_;
+
+            //- Number of equations
+            int n_;
+
+            //- Relative tolerance
+            scalar relTol_;
+
+            //- Absolute tolerance
+            scalar absTol_;
+
+            //- Jacobian and decomposition with the reuse policy
+            JacobianManager jacobian_;
+
+
+        // Protected Member Functions
+
+            //- Return the RMS norm of x_i / scale_i
+            scalar norm(const scalarField&, const scalarField&) const;
+
+            //- Calculate the error scale absTol + relTol |y_i|
+            void errorScale(const scalarField&, scalarField&) const;
+
+
+    public:
+
+        //- Constructor
+        ODESolver(const ODESystem&, const scalar, const scalar);
+
+        //- Destructor
+        virtual ~ODESolver();
+
+
+        // Selector
+
+            //- Return the solver with the given name
+            static smartPtr<ODESolver> New
+            (
+                const word,
+                const ODESystem&,
+                const scalar relTol = 1e-6,
+                const scalar absTol = 1e-12
+            );
+
+
+        // Member Functions
+
+            //- Integrate the state y from t0 to tEnd; dtTry is the initial
+            //  step size and is set to the estimate for the next call
+            virtual void solve
+            (
+                const scalar,
+                const scalar,
+                scalarField&,
+                scalar&
+            ) = 0;
+
+
+        // Return Functions
+
+            //- Return the number of equations
+            int nEqns() const;
+
+            //- Return the relative tolerance
+            scalar relTol() const;
+
+            //- Return the absolute tolerance
+            scalar absTol() const;
+
+            //- Return the Jacobian manager (counters)
+            const JacobianManager& jacobianManager() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ODESolver_hpp included
+
+// ************************************************************************* //
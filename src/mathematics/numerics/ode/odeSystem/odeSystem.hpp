@@ -0,0 +1,101 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ODESystem
+
+Description
+    Abstract base class of a system of ordinary differential equations
+    dy/dt = f(t, y) that is integrated by an ODESolver. The Jacobian
+    d(f)/d(y) is given in sparse format; its non-zero pattern is fixed and
+    returned once by jacobianStructure().
+
+SourceFiles
+    odeSystem.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ODESystem_hpp
+#define ODESystem_hpp
+
+#include "definitions.hpp"
+#include "sparseMatrix.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                          Class ODESystem Declaration
+\*---------------------------------------------------------------------------*/
+
+class ODESystem
+{
+    public:
+
+        //- Constructor
+        ODESystem();
+
+        //- Destructor
+        virtual ~ODESystem();
+
+
+        // Member Functions
+
+            //- Return the number of equations
+            virtual int nEqns() const = 0;
+
+            //- Calculate the derivatives dy/dt for the state y at time t
+            virtual void derivatives
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&
+            ) const = 0;
+
+            //- Calculate the derivatives dy/dt and the Jacobian d(f)/d(y)
+            //  into the structure of jacobianStructure()
+            virtual void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&,
+                SparseMatrix&
+            ) const = 0;
+
+            //- Return the sparse structure of the Jacobian (the values are
+            //  not used); the diagonal has to be included
+            virtual const SparseMatrix& jacobianStructure() const = 0;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ODESystem_hpp included
+
+// ************************************************************************* //
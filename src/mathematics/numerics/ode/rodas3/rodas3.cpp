@@ -0,0 +1,240 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "rodas3.hpp"
+#include <math.h>
+#include <limits>
+
+// * * * * * * * * * * * * * * * Static Data * * * * * * * * * * * * * * * //
+
+const TKC::scalar
+    TKC::Rodas3::gamma = 0.5,
+
+    TKC::Rodas3::a21 = 0,
+    TKC::Rodas3::a31 = 2,
+    TKC::Rodas3::a32 = 0,
+    TKC::Rodas3::a41 = 2,
+    TKC::Rodas3::a42 = 0,
+    TKC::Rodas3::a43 = 1,
+
+    TKC::Rodas3::c21 = 4,
+    TKC::Rodas3::c31 = 1,
+    TKC::Rodas3::c32 = -1,
+    TKC::Rodas3::c41 = 1,
+    TKC::Rodas3::c42 = -1,
+    TKC::Rodas3::c43 = -8.0L/3.0L,
+
+    TKC::Rodas3::b1 = 2,
+    TKC::Rodas3::b2 = 0,
+    TKC::Rodas3::b3 = 1,
+    TKC::Rodas3::b4 = 1,
+
+    TKC::Rodas3::e1 = 0,
+    TKC::Rodas3::e2 = 0,
+    TKC::Rodas3::e3 = 0,
+    TKC::Rodas3::e4 = 1;
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::Rodas3::Rodas3
+(
+    const ODESystem& odes,
+    const scalar relTol,
+    const scalar absTol
+)
+:
+    ODESolver(odes, relTol, absTol),
+    f0_(n_),
+    f_(n_),
+    yTmp_(n_),
+    yNew_(n_),
+    error_(n_),
+    scale_(n_),
+    K_(4, scalarField(n_))
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::Rodas3::~Rodas3()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::Rodas3::solve
+(
+    const scalar t0,
+    const scalar tEnd,
+    scalarField& y,
+    scalar& dtTry
+)
+{
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+
+    scalar t = t0;
+    scalar h = dtTry;
+
+    while (t < tEnd)
+    {
+        //- One Jacobian per step, kept for rejected steps
+        jacobian_.update(t, y, f0_);
+
+        bool rejected{false};
+
+        while (true)
+        {
+            //- Hit the end time exactly; a step that ends there anyway (the
+            //  caller advanced by the proposal) is not shortened
+            const bool shortened = t + h > tEnd;
+            const scalar hStep = (t + h >= tEnd) ? tEnd - t : h;
+
+            if (hStep < 10*eps*max(fabs(t), scalar(1e-300)))
+            {
+                ErrorMsg
+                (
+                    "The step size of the Rodas3 solver is too small at "
+                    "t = " + std::to_string(t),
+                    __FILE__,
+                    __LINE__
+                );
+            }
+
+            const scalar error = step(t, hStep, y);
+
+            //- New step size, not increased after a rejection
+            const scalar factor =
+                min
+                (
+                    rejected ? scalar(1) : scalar(6),
+                    max
+                    (
+                        scalar(0.2),
+                        scalar(0.9)*pow(max(error, eps), -scalar(1)/3)
+                    )
+                );
+
+            if (error <= 1)
+            {
+                t = (hStep == tEnd - t) ? tEnd : t + hStep;
+                y = yNew_;
+
+                jacobian_.step();
+
+                //- A shortened last step keeps the proposal
+                h = shortened ? min(h, hStep*factor) : hStep*factor;
+
+                break;
+            }
+
+            h = hStep*factor;
+            rejected = true;
+        }
+    }
+
+    dtTry = h;
+}
+
+
+TKC::scalar TKC::Rodas3::step
+(
+    const scalar t,
+    const scalar h,
+    const scalarField& y
+)
+{
+    //- One factorization of I - gamma h J for all stages
+    const scalar gh = gamma*h;
+
+    jacobian_.factorize(gh);
+
+    scalarField& K1 = K_[0];
+    scalarField& K2 = K_[1];
+    scalarField& K3 = K_[2];
+    scalarField& K4 = K_[3];
+
+    //- Stage 1
+    for (int i = 0; i < n_; ++i)
+    {
+        K1[i] = gh*f0_[i];
+    }
+
+    jacobian_.solve(K1);
+
+    //- Stage 2, a21 = 0: f(t, y) is already known
+    for (int i = 0; i < n_; ++i)
+    {
+        K2[i] = gh*(f0_[i] + c21*K1[i]/h);
+    }
+
+    jacobian_.solve(K2);
+
+    //- Stage 3
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] = y[i] + a31*K1[i] + a32*K2[i];
+    }
+
+    odes_.derivatives(t + h, yTmp_, f_);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        K3[i] = gh*(f_[i] + (c31*K1[i] + c32*K2[i])/h);
+    }
+
+    jacobian_.solve(K3);
+
+    //- Stage 4
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] = y[i] + a41*K1[i] + a42*K2[i] + a43*K3[i];
+    }
+
+    odes_.derivatives(t + h, yTmp_, f_);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        K4[i] = gh*(f_[i] + (c41*K1[i] + c42*K2[i] + c43*K3[i])/h);
+    }
+
+    jacobian_.solve(K4);
+
+    //- New state and the embedded error estimate
+    for (int i = 0; i < n_; ++i)
+    {
+        yNew_[i] = y[i] + b1*K1[i] + b2*K2[i] + b3*K3[i] + b4*K4[i];
+        error_[i] = e1*K1[i] + e2*K2[i] + e3*K3[i] + e4*K4[i];
+
+        yTmp_[i] = max(fabs(y[i]), fabs(yNew_[i]));
+    }
+
+    errorScale(yTmp_, scale_);
+
+    return norm(error_, scale_);
+}
+
+
+// ************************************************************************* //
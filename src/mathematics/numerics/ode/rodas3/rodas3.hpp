@@ -0,0 +1,132 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::Rodas3
+
+Description
+    Four stage, stiffly accurate Rosenbrock method of order 3 with an
+    embedded method of order 2 (RODAS3) [Sandu et al., Benchmarking stiff
+    ODE solvers for atmospheric chemistry problems II, Atmos. Environ. 31
+    (1997)]. Each stage solves
+
+        (1/(gamma h) I - J) K_i = f(y + sum_j a_ij K_j) + sum_j c_ij/h K_j
+
+    The stages are solved with I - gamma h J, the matrix of the
+    JacobianManager, and the right hand sides scaled by gamma h. Per step
+    the Jacobian is evaluated once and the matrix is factorized once
+    (sparse LU); the factorization is reused for all four stages. With
+    a21 = 0 the second stage reuses f(t, y), hence three evaluations of f
+    are needed per step. A rejected step keeps the Jacobian and only
+    factorizes again for the smaller step size. Unlike BDF the Jacobian
+    is not kept over accepted steps, the order of the method relies on the
+    exact Jacobian.
+
+    The method needs no history, hence the cost of short integrations
+    (e.g. the chemistry sub-steps of an operator split) is predictable.
+    The system is treated as autonomous (no df/dt term).
+
+SourceFiles
+    rodas3.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef Rodas3_hpp
+#define Rodas3_hpp
+
+#include "odeSolver.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                            Class Rodas3 Declaration
+\*---------------------------------------------------------------------------*/
+
+class Rodas3
+:
+    public ODESolver
+{
+    private:
+
+        // Coefficients of the method
+
+            static const scalar
+                gamma,
+                a21, a31, a32, a41, a42, a43,
+                c21, c31, c32, c41, c42, c43,
+                b1, b2, b3, b4,
+                e1, e2, e3, e4;
+
+
+        // Workspace
+
+            scalarField f0_;
+            scalarField f_;
+            scalarField yTmp_;
+            scalarField yNew_;
+            scalarField error_;
+            scalarField scale_;
+            List<scalarField> K_;
+
+
+        // Private Member Functions
+
+            //- Do one step of size h from y; returns the error norm,
+            //  the new state is stored in yNew_
+            scalar step(const scalar, const scalar, const scalarField&);
+
+
+    public:
+
+        //- Constructor
+        Rodas3(const ODESystem&, const scalar, const scalar);
+
+        //- Destructor
+        ~Rodas3();
+
+
+        // Member Functions
+
+            //- Integrate the state y from t0 to tEnd
+            void solve
+            (
+                const scalar,
+                const scalar,
+                scalarField&,
+                scalar&
+            );
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // Rodas3_hpp included
+
+// ************************************************************************* //
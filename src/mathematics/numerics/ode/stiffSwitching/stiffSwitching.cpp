@@ -0,0 +1,409 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "stiffSwitching.hpp"
+#include <math.h>
+#include <limits>
+
+// * * * * * * * * * * * * * * * Static Data * * * * * * * * * * * * * * * //
+
+const TKC::scalar
+    TKC::StiffSwitching::c2 = 1.0L/5.0L,
+    TKC::StiffSwitching::c3 = 3.0L/10.0L,
+    TKC::StiffSwitching::c4 = 4.0L/5.0L,
+    TKC::StiffSwitching::c5 = 8.0L/9.0L,
+
+    TKC::StiffSwitching::a21 = 1.0L/5.0L,
+
+    TKC::StiffSwitching::a31 = 3.0L/40.0L,
+    TKC::StiffSwitching::a32 = 9.0L/40.0L,
+
+    TKC::StiffSwitching::a41 = 44.0L/45.0L,
+    TKC::StiffSwitching::a42 = -56.0L/15.0L,
+    TKC::StiffSwitching::a43 = 32.0L/9.0L,
+
+    TKC::StiffSwitching::a51 = 19372.0L/6561.0L,
+    TKC::StiffSwitching::a52 = -25360.0L/2187.0L,
+    TKC::StiffSwitching::a53 = 64448.0L/6561.0L,
+    TKC::StiffSwitching::a54 = -212.0L/729.0L,
+
+    TKC::StiffSwitching::a61 = 9017.0L/3168.0L,
+    TKC::StiffSwitching::a62 = -355.0L/33.0L,
+    TKC::StiffSwitching::a63 = 46732.0L/5247.0L,
+    TKC::StiffSwitching::a64 = 49.0L/176.0L,
+    TKC::StiffSwitching::a65 = -5103.0L/18656.0L,
+
+    TKC::StiffSwitching::a71 = 35.0L/384.0L,
+    TKC::StiffSwitching::a73 = 500.0L/1113.0L,
+    TKC::StiffSwitching::a74 = 125.0L/192.0L,
+    TKC::StiffSwitching::a75 = -2187.0L/6784.0L,
+    TKC::StiffSwitching::a76 = 11.0L/84.0L,
+
+    TKC::StiffSwitching::e1 = 71.0L/57600.0L,
+    TKC::StiffSwitching::e3 = -71.0L/16695.0L,
+    TKC::StiffSwitching::e4 = 71.0L/1920.0L,
+    TKC::StiffSwitching::e5 = -17253.0L/339200.0L,
+    TKC::StiffSwitching::e6 = 22.0L/525.0L,
+    TKC::StiffSwitching::e7 = -1.0L/40.0L;
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::StiffSwitching::StiffSwitching
+(
+    const ODESystem& odes,
+    const scalar relTol,
+    const scalar absTol
+)
+:
+    BDF(odes, relTol, absTol),
+    K_(7, scalarField(n_)),
+    yTmp_(n_),
+    yStage_(n_),
+    yNew_(n_),
+    errorRK_(n_),
+    scaleRK_(n_)
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::StiffSwitching::~StiffSwitching()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::StiffSwitching::solve
+(
+    const scalar t0,
+    const scalar tEnd,
+    scalarField& y,
+    scalar& dtTry
+)
+{
+    if (dtTry <= 0)
+    {
+        ErrorMsg
+        (
+            "The initial step size of the StiffSwitching solver has to be "
+            "positive",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    scalar t = t0;
+    scalar h = dtTry;
+
+    while (t < tEnd)
+    {
+        if (stiff_)
+        {
+            implicitSteps(t, tEnd, y, h);
+        }
+        else
+        {
+            explicitSteps(t, tEnd, y, h);
+        }
+    }
+
+    dtTry = h;
+}
+
+
+void TKC::StiffSwitching::explicitSteps
+(
+    scalar& t,
+    const scalar tEnd,
+    scalarField& y,
+    scalar& h
+)
+{
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+
+    odes_.derivatives(t, y, K_[0]);
+
+    bool rejected{false};
+
+    while (t < tEnd)
+    {
+        //- Hit the end time exactly; a step that ends there anyway (the
+        //  caller advanced by the proposal) is not shortened
+        const bool shortened = t + h > tEnd;
+        const scalar hStep = (t + h >= tEnd) ? tEnd - t : h;
+
+        if (hStep < 10*eps*max(fabs(t), scalar(1e-300)))
+        {
+            ErrorMsg
+            (
+                "The step size of the StiffSwitching solver is too small at "
+                "t = " + std::to_string(t),
+                __FILE__,
+                __LINE__
+            );
+        }
+
+        const scalar error = explicitStep(t, hStep, y);
+
+        if (!std::isfinite(error))
+        {
+            h = 0.2*hStep;
+            rejected = true;
+
+            continue;
+        }
+
+        //- New step size, not increased after a rejection
+        const scalar factor =
+            min
+            (
+                rejected ? scalar(1) : scalar(10),
+                max
+                (
+                    scalar(0.2),
+                    scalar(0.9)*pow(max(error, eps), -scalar(1)/5)
+                )
+            );
+
+        if (error > 1)
+        {
+            h = hStep*factor;
+            rejected = true;
+
+            continue;
+        }
+
+        t = (hStep == tEnd - t) ? tEnd : t + hStep;
+        y = yNew_;
+
+        //- First same as last
+        std::swap(K_[0], K_[6]);
+
+        ++nExplicitSteps_;
+
+        //- A shortened last step keeps the proposal
+        h = shortened ? min(h, hStep*factor) : hStep*factor;
+        rejected = false;
+
+        if (detectStiffness())
+        {
+            stiff_ = true;
+            nCheck_ = 0;
+            ++nSwitches_;
+
+            return;
+        }
+    }
+}
+
+
+void TKC::StiffSwitching::implicitSteps
+(
+    scalar& t,
+    const scalar tEnd,
+    scalarField& y,
+    scalar& h
+)
+{
+    //- Continue with the history if the state was not changed
+    if (!started_ || t != t_ || y != D_[0])
+    {
+        start(t, y, h);
+    }
+
+    while (t_ < tEnd)
+    {
+        step(tEnd);
+
+        ++nImplicitSteps_;
+
+        if (++nCheck_ < checkInterval_)
+        {
+            continue;
+        }
+
+        nCheck_ = 0;
+
+        //- The explicit method is stable with a multiple of the actual
+        //  step size
+        if (margin_*h_*jacobian_.spectralRadius() < stabilityLimit_)
+        {
+            stiff_ = false;
+            nStiffSteps_ = 0;
+            nNonStiffSteps_ = 0;
+            ++nSwitches_;
+
+            break;
+        }
+    }
+
+    t = t_;
+    y = D_[0];
+    h = h_;
+}
+
+
+TKC::scalar TKC::StiffSwitching::explicitStep
+(
+    const scalar t,
+    const scalar h,
+    const scalarField& y
+)
+{
+    const scalarField& K1 = K_[0];
+    scalarField& K2 = K_[1];
+    scalarField& K3 = K_[2];
+    scalarField& K4 = K_[3];
+    scalarField& K5 = K_[4];
+    scalarField& K6 = K_[5];
+    scalarField& K7 = K_[6];
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] = y[i] + h*a21*K1[i];
+    }
+
+    odes_.derivatives(t + c2*h, yTmp_, K2);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] = y[i] + h*(a31*K1[i] + a32*K2[i]);
+    }
+
+    odes_.derivatives(t + c3*h, yTmp_, K3);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] = y[i] + h*(a41*K1[i] + a42*K2[i] + a43*K3[i]);
+    }
+
+    odes_.derivatives(t + c4*h, yTmp_, K4);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yTmp_[i] =
+            y[i] + h*(a51*K1[i] + a52*K2[i] + a53*K3[i] + a54*K4[i]);
+    }
+
+    odes_.derivatives(t + c5*h, yTmp_, K5);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yStage_[i] =
+            y[i]
+          + h*(a61*K1[i] + a62*K2[i] + a63*K3[i] + a64*K4[i] + a65*K5[i]);
+    }
+
+    odes_.derivatives(t + h, yStage_, K6);
+
+    for (int i = 0; i < n_; ++i)
+    {
+        yNew_[i] =
+            y[i]
+          + h*(a71*K1[i] + a73*K3[i] + a74*K4[i] + a75*K5[i] + a76*K6[i]);
+    }
+
+    odes_.derivatives(t + h, yNew_, K7);
+
+    //- Error estimate and h lambda out of the last two stages
+    scalar num{0};
+    scalar den{0};
+
+    for (int i = 0; i < n_; ++i)
+    {
+        errorRK_[i] =
+            h
+           *(
+                e1*K1[i] + e3*K3[i] + e4*K4[i]
+              + e5*K5[i] + e6*K6[i] + e7*K7[i]
+            );
+
+        yTmp_[i] = max(fabs(y[i]), fabs(yNew_[i]));
+
+        const scalar dK = K7[i] - K6[i];
+        const scalar dy = yNew_[i] - yStage_[i];
+
+        num += dK*dK;
+        den += dy*dy;
+    }
+
+    hLambda_ = (den > 0) ? h*sqrt(num/den) : 0;
+
+    errorScale(yTmp_, scaleRK_);
+
+    return norm(errorRK_, scaleRK_);
+}
+
+
+bool TKC::StiffSwitching::detectStiffness()
+{
+    if (hLambda_ > stabilityLimit_)
+    {
+        nNonStiffSteps_ = 0;
+
+        if (++nStiffSteps_ >= nStiff_)
+        {
+            nStiffSteps_ = 0;
+
+            return true;
+        }
+    }
+    else if (++nNonStiffSteps_ >= nNonStiff_)
+    {
+        nStiffSteps_ = 0;
+    }
+
+    return false;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+bool TKC::StiffSwitching::stiff() const
+{
+    return stiff_;
+}
+
+
+int TKC::StiffSwitching::nExplicitSteps() const
+{
+    return nExplicitSteps_;
+}
+
+
+int TKC::StiffSwitching::nImplicitSteps() const
+{
+    return nImplicitSteps_;
+}
+
+
+int TKC::StiffSwitching::nSwitches() const
+{
+    return nSwitches_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,203 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+
+Class
+    TKC::StiffSwitching
+
+Description
+    Solver that switches automatically between an explicit and an implicit
+    method depending on the stiffness of the system. Before the ignition and
+    in other non-stiff parts of the trajectory the explicit Runge-Kutta
+    method of Dormand and Prince 5(4) is cheaper than any implicit method
+    (no Jacobian, no decomposition); where the system becomes stiff, the
+    steps are done with BDF.
+
+    + explicit to implicit: after each accepted step the product h lambda
+      is estimated out of the last two stages [Hairer and Wanner, Solving
+      Ordinary Differential Equations II, Sec. IV.2]. If it exceeds the
+      stability limit of the method in nStiff steps without nNonStiff
+      steps in between, BDF is started with the actual step size
+    + implicit to explicit: every checkInterval steps the dominant
+      eigenvalue of the BDF Jacobian is estimated (power iteration, see
+      JacobianManager). If the explicit method is stable for margin times
+      the actual BDF step size, the integration continues explicitly; the
+      margin avoids switching back and forth
+
+    The mode and the BDF history are kept between the solve() calls.
+
+SourceFiles
+    stiffSwitching.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef StiffSwitching_hpp
+#define StiffSwitching_hpp
+
+#include "bdf.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                        Class StiffSwitching Declaration
+\*---------------------------------------------------------------------------*/
+
+class StiffSwitching
+:
+    public BDF
+{
+    private:
+
+        // Coefficients of the Dormand-Prince method
+
+            static const scalar
+                c2, c3, c4, c5,
+                a21,
+                a31, a32,
+                a41, a42, a43,
+                a51, a52, a53, a54,
+                a61, a62, a63, a64, a65,
+                a71, a73, a74, a75, a76,
+                e1, e3, e4, e5, e6, e7;
+
+
+        // Private Constants
+
+            //- Stability limit of the explicit method for h lambda
+            static constexpr scalar stabilityLimit_{3.25};
+
+            //- Number of stiff steps to switch to the implicit method
+            static constexpr int nStiff_{15};
+
+            //- Number of non-stiff steps that reset the stiff steps
+            static constexpr int nNonStiff_{6};
+
+            //- Number of implicit steps between the stiffness checks
+            static constexpr int checkInterval_{10};
+
+            //- Ratio of the stable explicit to the implicit step size that
+            //  is required to switch back
+            static constexpr scalar margin_{4};
+
+
+        // Private Data
+
+            //- The system is integrated with the implicit method
+            bool stiff_{false};
+
+            //- Stiff and non-stiff explicit steps of the detection
+            int nStiffSteps_{0};
+            int nNonStiffSteps_{0};
+
+            //- Implicit steps since the last check
+            int nCheck_{0};
+
+            //- Estimate of h lambda of the last explicit step
+            scalar hLambda_{0};
+
+
+        // Counters
+
+            int nExplicitSteps_{0};
+            int nImplicitSteps_{0};
+            int nSwitches_{0};
+
+
+        // Workspace
+
+            List<scalarField> K_;
+            scalarField yTmp_;
+            scalarField yStage_;
+            scalarField yNew_;
+            scalarField errorRK_;
+            scalarField scaleRK_;
+
+
+        // Private Member Functions
+
+            //- Integrate explicitly from t towards tEnd until the end or
+            //  the detection of stiffness
+            void explicitSteps(scalar&, const scalar, scalarField&, scalar&);
+
+            //- Integrate with BDF from t towards tEnd until the end or
+            //  until the system is no longer stiff
+            void implicitSteps(scalar&, const scalar, scalarField&, scalar&);
+
+            //- Do one explicit step of size h from y (K_[0] = f(t, y));
+            //  returns the error norm, the new state is stored in yNew_
+            scalar explicitStep(const scalar, const scalar, const scalarField&);
+
+            //- Update the detection with the last accepted explicit step;
+            //  returns true if the system is stiff
+            bool detectStiffness();
+
+
+    public:
+
+        //- Constructor
+        StiffSwitching(const ODESystem&, const scalar, const scalar);
+
+        //- Destructor
+        ~StiffSwitching();
+
+
+        // Member Functions
+
+            //- Integrate the state y from t0 to tEnd
+            void solve
+            (
+                const scalar,
+                const scalar,
+                scalarField&,
+                scalar&
+            );
+
+
+        // Return Functions
+
+            //- Return true if the implicit method is active
+            bool stiff() const;
+
+            //- Return the number of accepted explicit steps
+            int nExplicitSteps() const;
+
+            //- Return the number of accepted implicit steps
+            int nImplicitSteps() const;
+
+            //- Return the number of switches between the methods
+            int nSwitches() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // StiffSwitching_hpp included
+
+// ************************************************************************* //
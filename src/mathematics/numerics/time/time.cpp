@@ -26,6 +26,8 @@ License
 #include "definitions.hpp"
 #include "time.hpp"
 #include "timeReader.hpp"
+#include <math.h>
+#include <limits>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -49,8 +51,37 @@ TKC::Time::~Time()
 
 void TKC::Time::operator+=(const scalar deltaT)
 {
-    Info<< "Operator" << runTime() << " + " << deltaT << endl;
-    runTime_ = runTime() + deltaT;
+    const scalar eps = std::numeric_limits<scalar>::epsilon();
+
+    runTimeOld_ = runTime_;
+    runTime_ += deltaT;
+
+    //- Round-off of the clipped steps
+    const scalar tol = 1e-6*fabs(deltaT) + 100*eps*fabs(runTime_);
+
+    write_ = writeTime_ <= 0;
+
+    if (writeTime_ > 0)
+    {
+        while ((writeIndex_ + 1)*writeTime_ <= runTime_ + tol)
+        {
+            ++writeIndex_;
+
+            write_ = true;
+        }
+
+        if (write_ && fabs(runTime_ - writeIndex_*writeTime_) <= tol)
+        {
+            runTime_ = writeIndex_*writeTime_;
+        }
+    }
+
+    if (fabs(runTime_ - endTime_) <= tol)
+    {
+        runTime_ = endTime_;
+
+        write_ = true;
+    }
 }
 
 
@@ -80,43 +111,122 @@ void TKC::Time::dTFlow(const scalar value)
 }
 
 
+void TKC::Time::maxDeltaT(const scalar value)
+{
+    maxDeltaT_ = value;
+}
+
+
+void TKC::Time::adjustDeltaT(const scalar proposal)
+{
+    if (proposal <= 0)
+    {
+        ErrorMsg
+        (
+            "The proposed time step has to be positive",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    deltaTKinetic_ = maxDeltaT_ > 0 ? min(proposal, maxDeltaT_) : proposal;
+}
+
+
+void TKC::Time::stop()
+{
+    stopped_ = true;
+}
+
+
 // * * * * * * * * * * * * * * * Return function * * * * * * * * * * * * * * //
 
-const TKC::scalar TKC::Time::runTime() const
+TKC::scalar TKC::Time::runTime() const
 {
     return runTime_;
 }
 
 
-const TKC::scalar TKC::Time::endTime() const
+TKC::scalar TKC::Time::endTime() const
 {
     return endTime_;
 }
 
 
-const TKC::scalar TKC::Time::writeTime() const
+TKC::scalar TKC::Time::writeTime() const
 {
     return writeTime_;
 }
 
 
-const TKC::scalar TKC::Time::dTKinetic() const
+TKC::scalar TKC::Time::dTKinetic() const
 {
     return deltaTKinetic_;
 }
 
 
-const TKC::scalar TKC::Time::dTFlow() const
+TKC::scalar TKC::Time::dTFlow() const
 {
     return deltaTFlow_;
 }
 
 
+TKC::scalar TKC::Time::maxDeltaT() const
+{
+    return maxDeltaT_;
+}
+
+
+TKC::scalar TKC::Time::deltaT() const
+{
+    scalar deltaT = deltaTKinetic_;
+
+    if (maxDeltaT_ > 0)
+    {
+        deltaT = min(deltaT, maxDeltaT_);
+    }
+
+    const scalar remaining = nextTime() - runTime_;
+
+    //- Hit the next write or end time, split the rest instead of leaving
+    //  a small sliver
+    if (remaining <= 1.01*deltaT)
+    {
+        return remaining;
+    }
+    else if (remaining < 2*deltaT)
+    {
+        return 0.5*remaining;
+    }
+
+    return deltaT;
+}
+
+
+bool TKC::Time::write() const
+{
+    return write_;
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+TKC::scalar TKC::Time::nextTime() const
+{
+    if (writeTime_ > 0)
+    {
+        return min(endTime_, (writeIndex_ + 1)*writeTime_);
+    }
+
+    return endTime_;
+}
+
+
 // * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
 
-const bool TKC::Time::loop() const
+bool TKC::Time::loop() const
 {
-    if (runTime_ == endTime_)
+    if (stopped_ || runTime_ == endTime_)
     {
         return 0;
     }
@@ -160,6 +270,102 @@ void TKC::Time::checkData() const
             __LINE__
         );
     }
+
+    if (maxDeltaT_ < 0)
+    {
+        ErrorMsg
+        (
+            "The maximum time step is negative",
+            __FILE__,
+            __LINE__
+        );
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * * Events  * * * * * * * * * * * * * * * * //
+
+int TKC::Time::addEvent
+(
+    const word name,
+    const int direction,
+    const bool terminal
+)
+{
+    eventNames_.push_back(name);
+    eventDirection_.push_back(direction);
+    eventTerminal_.push_back(terminal);
+    eventValue_.push_back(0);
+    eventStarted_.push_back(false);
+    eventTriggered_.push_back(false);
+    eventTime_.push_back(0);
+
+    return eventNames_.size() - 1;
+}
+
+
+void TKC::Time::updateEvent(const int i, const scalar g)
+{
+    const scalar gOld = eventValue_[i];
+
+    eventValue_[i] = g;
+
+    if (!eventStarted_[i])
+    {
+        eventStarted_[i] = true;
+
+        return;
+    }
+
+    if (eventTriggered_[i])
+    {
+        return;
+    }
+
+    const bool rising = gOld < 0 && g >= 0;
+    const bool falling = gOld > 0 && g <= 0;
+
+    if
+    (
+        (rising && eventDirection_[i] >= 0)
+     || (falling && eventDirection_[i] <= 0)
+    )
+    {
+        //- Linear interpolation within the last step
+        eventTime_[i] =
+            runTimeOld_ + (runTime_ - runTimeOld_)*gOld/(gOld - g);
+
+        eventTriggered_[i] = true;
+
+        if (eventTerminal_[i])
+        {
+            stopped_ = true;
+        }
+    }
+}
+
+
+int TKC::Time::nEvents() const
+{
+    return eventNames_.size();
+}
+
+
+TKC::word TKC::Time::eventName(const int i) const
+{
+    return eventNames_[i];
+}
+
+
+bool TKC::Time::eventTriggered(const int i) const
+{
+    return eventTriggered_[i];
+}
+
+
+TKC::scalar TKC::Time::eventTime(const int i) const
+{
+    return eventTime_[i];
 }
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
@@ -25,10 +25,19 @@ Class
     TKC::Time
 
 Description
-    Abstract TKC::Time class for building and calculating matrices
+    Time control of the transient calculations. The time step is proposed by
+    the error control of the integrator (adjustDeltaT, optionally limited by
+    maxDeltaT) and clipped such that the write times (multiples of
+    writeTime) and the end time are hit exactly; the run time is set to
+    these values on arrival, hence no round-off accumulates over the steps.
+
+    Events are defined by a function g that is given after each step
+    (updateEvent). If g changes its sign in the given direction, the event
+    time is located by linear interpolation within the last step; a
+    terminal event stops the time loop (e.g. at the ignition).
 
 SourceFiles
-    numerics.cpp
+    time.cpp
 
 \*---------------------------------------------------------------------------*/
 
@@ -67,6 +76,51 @@ class Time
             //- Flow time step (for Flamelet calculation)
             scalar deltaTFlow_{0};
 
+            //- Maximum time step (no limit if zero)
+            scalar maxDeltaT_{0};
+
+            //- Run time before the last increment
+            scalar runTimeOld_{0};
+
+            //- Number of write times that are reached
+            int writeIndex_{0};
+
+            //- The last increment reached a write time
+            bool write_{false};
+
+            //- The time loop is stopped
+            bool stopped_{false};
+
+
+        //- Events
+
+            //- Name of the events
+            wordList eventNames_;
+
+            //- Direction of the sign change (+1 rising, -1 falling, 0 both)
+            intList eventDirection_;
+
+            //- The time loop is stopped at the event
+            boolList eventTerminal_;
+
+            //- Last value of the event function
+            scalarList eventValue_;
+
+            //- Event function is given at least once
+            boolList eventStarted_;
+
+            //- Event occurred
+            boolList eventTriggered_;
+
+            //- Time of the event
+            scalarList eventTime_;
+
+
+        // Private Member Functions
+
+            //- Return the next write or end time
+            scalar nextTime() const;
+
 
     public:
 
@@ -81,9 +135,11 @@ class Time
 
         // Operators
 
-            //- Increment runTime based on a given delta t
+            //- Increment runTime based on a given delta t; write and end
+            //  times within round-off are hit exactly
             void operator+=(const scalar);
 
+
         // Insert Functions
 
             //- Insert the end time for calculation
@@ -98,32 +154,79 @@ class Time
             //- Update the flow time step
             void dTFlow(const scalar);
 
+            //- Insert the maximum time step
+            void maxDeltaT(const scalar);
+
+            //- Adjust the kinetic time step to the proposal of the
+            //  integrator (limited by maxDeltaT)
+            void adjustDeltaT(const scalar);
+
+            //- Stop the time loop
+            void stop();
+
 
         // Return Functions
 
             //- Return the actual run time
-            const scalar runTime() const;
+            scalar runTime() const;
 
             //- Return the end time of the calculation
-            const scalar endTime() const;
+            scalar endTime() const;
 
             //- Return the time after which the results are stored
-            const scalar writeTime() const;
+            scalar writeTime() const;
 
             //- Return the actual time step for the kinetic
-            const scalar dTKinetic() const;
+            scalar dTKinetic() const;
 
             //- Return the actual time step for the flow
-            const scalar dTFlow() const;
+            scalar dTFlow() const;
+
+            //- Return the maximum time step
+            scalar maxDeltaT() const;
+
+            //- Return the next kinetic time step, clipped to the next write
+            //  or end time (remaining slivers are avoided)
+            scalar deltaT() const;
+
+            //- Return true if the last increment reached a write time
+            bool write() const;
 
 
         // Member functions
 
             //- Returns true if the end time is not reached
-            const bool loop() const;
+            bool loop() const;
 
             //- Check the data
             void checkData() const;
+
+
+        // Events
+
+            //- Add an event with the name, the direction of the sign
+            //  change and if it stops the loop; returns its index
+            int addEvent
+            (
+                const word,
+                const int direction = 0,
+                const bool terminal = false
+            );
+
+            //- Update the event function of the event i at the run time
+            void updateEvent(const int, const scalar);
+
+            //- Return the number of events
+            int nEvents() const;
+
+            //- Return the name of event i
+            word eventName(const int) const;
+
+            //- Return true if event i occurred
+            bool eventTriggered(const int) const;
+
+            //- Return the time of event i
+            scalar eventTime(const int) const;
 };
 
 
@@ -123,6 +123,21 @@ void TKC::TimeReader::read(Time& time)
 
                 time.endTime(stod(tmp[1]));
             }
+            else if (tmp[0] == "maxDeltaT")
+            {
+                if (tmp[1].empty())
+                {
+                    ErrorMsg
+                    (
+                        "No value for maxDeltaT is specified or it "
+                        "is not a correct type (" + file_ + ")",
+                        __FILE__,
+                        __LINE__
+                    );
+                }
+
+                time.maxDeltaT(stod(tmp[1]));
+            }
         }
     }
 }
@@ -0,0 +1,416 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "sparseMatrix.hpp"
+#include <algorithm>
+#include <set>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::SparseMatrix::SparseMatrix()
+{}
+
+
+TKC::SparseMatrix::SparseMatrix
+(
+    const List<List<int>>& pattern,
+    const bool reorder
+)
+:
+    n_(pattern.size())
+{
+    //- Identity permutation
+    perm_.resize(n_);
+    invPerm_.resize(n_);
+
+    for (size_t i = 0; i < n_; ++i)
+    {
+        perm_[i] = i;
+        invPerm_[i] = i;
+    }
+
+    //- Fill-reducing ordering
+    if (reorder)
+    {
+        RCM(pattern);
+    }
+
+    //- Build the structure incl. LU fill-in
+    symbolicLU(pattern);
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::SparseMatrix::~SparseMatrix()
+{}
+
+
+// * * * * * * * * * * * * * * Operator Functions  * * * * * * * * * * * * * //
+
+TKC::scalar TKC::SparseMatrix::operator()
+(
+    const size_t i,
+    const size_t j
+) const
+{
+    const int pos = find(i, j);
+
+    return (pos == -1 ? scalar(0) : values_[pos]);
+}
+
+
+TKC::scalar& TKC::SparseMatrix::operator()
+(
+    const size_t i,
+    const size_t j
+)
+{
+    const int pos = find(i, j);
+
+    if (pos == -1)
+    {
+        ErrorMsg
+        (
+            "    The element (" + toStr(i) + ", " + toStr(j) + ") is not part"
+            " of the sparse matrix pattern",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    return values_[pos];
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+int TKC::SparseMatrix::find(const size_t i, const size_t j) const
+{
+    //- Reordered indices
+    const int row = invPerm_[i];
+    const int col = invPerm_[j];
+
+    const auto first = colID_.begin() + rowStart_[row];
+    const auto last = colID_.begin() + rowStart_[row+1];
+
+    const auto it = std::lower_bound(first, last, col);
+
+    if (it == last || *it != col)
+    {
+        return -1;
+    }
+
+    return (it - colID_.begin());
+}
+
+
+void TKC::SparseMatrix::reset()
+{
+    std::fill(values_.begin(), values_.end(), scalar(0));
+}
+
+
+void TKC::SparseMatrix::LU()
+{
+    //- Position of column j in the actual row, -1 if not included
+    List<int> pos(n_, -1);
+
+    for (size_t i = 0; i < n_; ++i)
+    {
+        for (int p = rowStart_[i]; p < rowStart_[i+1]; ++p)
+        {
+            pos[colID_[p]] = p;
+        }
+
+        //- Eliminate the lower part (columns are sorted, hence the rows k
+        //  are processed in the correct order)
+        for (int p = rowStart_[i]; p < diag_[i]; ++p)
+        {
+            const int k = colID_[p];
+
+            if (values_[diag_[k]] == 0)
+            {
+                ErrorMsg
+                (
+                    "    Zero pivot in row " + toStr(k) + " of the sparse"
+                    " LU decomposition",
+                    __FILE__,
+                    __LINE__
+                );
+            }
+
+            //- l_ik
+            values_[p] /= values_[diag_[k]];
+
+            const scalar lik = values_[p];
+
+            //- Row i -= l_ik * U row k; included due to the symbolic fill-in
+            for (int q = diag_[k] + 1; q < rowStart_[k+1]; ++q)
+            {
+                values_[pos[colID_[q]]] -= lik * values_[q];
+            }
+        }
+
+        for (int p = rowStart_[i]; p < rowStart_[i+1]; ++p)
+        {
+            pos[colID_[p]] = -1;
+        }
+    }
+}
+
+
+void TKC::SparseMatrix::solve(scalarField& b) const
+{
+    //- Reordered right hand side
+    scalarField y(n_);
+
+    for (size_t i = 0; i < n_; ++i)
+    {
+        y[i] = b[perm_[i]];
+    }
+
+    //- Forward substitution L y = b (unit diagonal)
+    for (size_t i = 0; i < n_; ++i)
+    {
+        for (int p = rowStart_[i]; p < diag_[i]; ++p)
+        {
+            y[i] -= values_[p] * y[colID_[p]];
+        }
+    }
+
+    //- Backward substitution U x = y
+    for (int i = n_-1; i >= 0; --i)
+    {
+        for (int p = diag_[i] + 1; p < rowStart_[i+1]; ++p)
+        {
+            y[i] -= values_[p] * y[colID_[p]];
+        }
+
+        y[i] /= values_[diag_[i]];
+    }
+
+    //- Back to the original order
+    for (size_t i = 0; i < n_; ++i)
+    {
+        b[perm_[i]] = y[i];
+    }
+}
+
+
+void TKC::SparseMatrix::multiply(const scalarField& x, scalarField& y) const
+{
+    y.assign(n_, 0);
+
+    for (size_t i = 0; i < n_; ++i)
+    {
+        scalar sum{0};
+
+        for (int p = rowStart_[i]; p < rowStart_[i+1]; ++p)
+        {
+            sum += values_[p] * x[perm_[colID_[p]]];
+        }
+
+        y[perm_[i]] = sum;
+    }
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::SparseMatrix::RCM(const List<List<int>>& pattern)
+{
+    //- Symmetric adjacency (pattern of A + A^T) without the diagonal
+    List<std::set<int>> adj(n_);
+
+    forEach(pattern, i)
+    {
+        forAll(pattern[i], j)
+        {
+            if (size_t(j) != i)
+            {
+                adj[i].insert(j);
+                adj[j].insert(i);
+            }
+        }
+    }
+
+    List<bool> visited(n_, false);
+    List<int> order;
+    order.reserve(n_);
+
+    //- Breadth first search for each connected component, starting at the
+    //  node with the minimum degree
+    while (order.size() < n_)
+    {
+        int start{-1};
+
+        for (size_t i = 0; i < n_; ++i)
+        {
+            if
+            (
+                !visited[i]
+             && (start == -1 || adj[i].size() < adj[start].size())
+            )
+            {
+                start = i;
+            }
+        }
+
+        visited[start] = true;
+        order.push_back(start);
+
+        for (size_t head = order.size()-1; head < order.size(); ++head)
+        {
+            //- Neighbours that are not visited, sorted by their degree
+            List<int> next;
+
+            forAll(adj[order[head]], j)
+            {
+                if (!visited[j])
+                {
+                    visited[j] = true;
+                    next.push_back(j);
+                }
+            }
+
+            std::stable_sort
+            (
+                next.begin(),
+                next.end(),
+                [&adj](const int a, const int b)
+                {
+                    return adj[a].size() < adj[b].size();
+                }
+            );
+
+            order.insert(order.end(), next.begin(), next.end());
+        }
+    }
+
+    //- Reverse Cuthill-McKee
+    for (size_t i = 0; i < n_; ++i)
+    {
+        perm_[i] = order[n_-1-i];
+        invPerm_[perm_[i]] = i;
+    }
+}
+
+
+void TKC::SparseMatrix::symbolicLU(const List<List<int>>& pattern)
+{
+    //- Reordered pattern incl. diagonal
+    List<std::set<int>> rows(n_);
+
+    forEach(pattern, i)
+    {
+        const int row = invPerm_[i];
+
+        rows[row].insert(row);
+
+        forAll(pattern[i], j)
+        {
+            rows[row].insert(invPerm_[j]);
+        }
+    }
+
+    //- Fill-in: row i gets the upper part of each row k < i it depends on.
+    //  Entries added during the loop are > k and visited afterwards
+    for (size_t i = 0; i < n_; ++i)
+    {
+        for (auto it = rows[i].begin(); *it < int(i); ++it)
+        {
+            const int k = *it;
+
+            for (auto jt = rows[k].upper_bound(k); jt != rows[k].end(); ++jt)
+            {
+                rows[i].insert(*jt);
+            }
+        }
+    }
+
+    //- CSR structure
+    rowStart_.assign(1, 0);
+    colID_.clear();
+    diag_.resize(n_);
+
+    for (size_t i = 0; i < n_; ++i)
+    {
+        forAll(rows[i], j)
+        {
+            if (j == int(i))
+            {
+                diag_[i] = colID_.size();
+            }
+
+            colID_.push_back(j);
+        }
+
+        rowStart_.push_back(colID_.size());
+    }
+
+    values_.assign(colID_.size(), 0);
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+size_t TKC::SparseMatrix::rows() const
+{
+    return n_;
+}
+
+
+size_t TKC::SparseMatrix::cols() const
+{
+    return n_;
+}
+
+
+size_t TKC::SparseMatrix::nonZeros() const
+{
+    return values_.size();
+}
+
+
+TKC::scalarField& TKC::SparseMatrix::values()
+{
+    return values_;
+}
+
+
+const TKC::scalarField& TKC::SparseMatrix::values() const
+{
+    return values_;
+}
+
+
+const TKC::List<int>& TKC::SparseMatrix::permutation() const
+{
+    return perm_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,161 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::SparseMatrix
+
+Description
+    Square sparse matrix (n x n) with a fixed non-zero pattern in CSR format.
+    The symbolic structure is built once in the constructor:
+
+    + the rows and columns are reordered symmetrically with the reverse
+      Cuthill-McKee algorithm (fill-reducing, smaller bandwidth)
+    + the diagonal and the fill-in of the LU decomposition (no pivoting)
+      are added to the pattern
+
+    Afterwards only the values are refilled, e.g. for each new Jacobian.
+    The element access A(i,j) always uses the original (not reordered)
+    indices. The LU decomposition is done in place on the fixed pattern.
+
+SourceFiles
+    sparseMatrix.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef SparseMatrix_hpp
+#define SparseMatrix_hpp
+
+#include "definitions.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                         Class SparseMatrix Declaration
+\*---------------------------------------------------------------------------*/
+
+class SparseMatrix
+{
+    private:
+
+        // Private Data
+
+            //- Size of the matrix (n x n)
+            size_t n_{0};
+
+            //- CSR structure (reordered indices, sorted columns)
+            List<int> rowStart_;
+            List<int> colID_;
+
+            //- Position of the diagonal element of each row
+            List<int> diag_;
+
+            //- Values of the non-zero elements
+            scalarField values_;
+
+            //- Permutation, perm_[new] = old and invPerm_[old] = new
+            List<int> perm_;
+            List<int> invPerm_;
+
+
+        // Private Member Functions
+
+            //- Calculate the reverse Cuthill-McKee ordering of the pattern
+            void RCM(const List<List<int>>&);
+
+            //- Build the CSR structure incl. diagonal and LU fill-in
+            void symbolicLU(const List<List<int>>&);
+
+
+    public:
+
+        //- Constructor
+        SparseMatrix();
+
+        //- Constructor that creates the structure out of the non-zero
+        //  pattern (column indices of each row) of a square matrix
+        SparseMatrix(const List<List<int>>&, const bool reorder = true);
+
+        //- Destructor
+        ~SparseMatrix();
+
+
+        // Operator Functions
+
+            //- Return the element (i,j), zero if not in the pattern
+            scalar operator()(const size_t, const size_t) const;
+
+            //- Assign operator, (i,j) has to be in the pattern
+            scalar& operator()(const size_t, const size_t);
+
+
+        // Member Functions
+
+            //- Return the position of element (i,j) in the values, -1 if
+            //  the element is not in the pattern
+            int find(const size_t, const size_t) const;
+
+            //- Set all values to zero (the pattern is kept)
+            void reset();
+
+            //- Decompose the matrix in place into L (unit diagonal) and U
+            void LU();
+
+            //- Solve A x = b after LU(), b is overwritten by x
+            void solve(scalarField&) const;
+
+            //- Matrix vector product y = A x (not for decomposed matrices)
+            void multiply(const scalarField&, scalarField&) const;
+
+
+        // Return Functions
+
+            //- Return rows of the matrix
+            size_t rows() const;
+
+            //- Return cols of the matrix
+            size_t cols() const;
+
+            //- Return the number of stored elements (incl. fill-in)
+            size_t nonZeros() const;
+
+            //- Return the values of the matrix (positions out of find())
+            scalarField& values();
+            const scalarField& values() const;
+
+            //- Return the permutation (new -> old)
+            const List<int>& permutation() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // SparseMatrix_hpp included
+
+// ************************************************************************* //
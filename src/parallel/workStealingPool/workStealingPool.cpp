@@ -0,0 +1,204 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "workStealingPool.hpp"
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::WorkStealingPool::WorkStealingPool(const int nThreads)
+:
+    nThreads_(nThreads)
+{
+    if (nThreads_ <= 0)
+    {
+        nThreads_ = max(int(std::thread::hardware_concurrency()), 1);
+    }
+
+    for (int w = 0; w < nThreads_; ++w)
+    {
+        queues_.push_back(smartPtr<TaskQueue>(new TaskQueue));
+    }
+
+    for (int w = 0; w < nThreads_; ++w)
+    {
+        threads_.push_back(std::thread(&WorkStealingPool::work, this, w));
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    wake_.notify_all();
+
+    forAll(threads_, thread)
+    {
+        thread.join();
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::WorkStealingPool::run
+(
+    const int nTasks,
+    const std::function<void(const int, const int)>& job
+)
+{
+    if (nTasks <= 0)
+    {
+        return;
+    }
+
+    //- Set the job before the tasks are visible; workers that are still
+    //  looking for tasks of the last run synchronise via the queue mutex
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        job_ = job;
+        remaining_ = nTasks;
+    }
+
+    //- Initial distribution, contiguous chunks per worker
+    for (int w = 0; w < nThreads_; ++w)
+    {
+        const int first = (long(nTasks) * w) / nThreads_;
+        const int last = (long(nTasks) * (w+1)) / nThreads_;
+
+        std::lock_guard<std::mutex> lock(queues_[w]->mutex);
+
+        for (int t = first; t < last; ++t)
+        {
+            queues_[w]->tasks.push_back(t);
+        }
+    }
+
+    //- Start the workers
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+    }
+
+    wake_.notify_all();
+
+    //- Wait until all tasks are done
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    done_.wait(lock, [this]{ return remaining_ == 0; });
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::WorkStealingPool::work(const int w)
+{
+    unsigned long seen{0};
+
+    for (;;)
+    {
+        //- Wait for a new run
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            wake_.wait(lock, [&]{ return stop_ || generation_ != seen; });
+
+            if (stop_)
+            {
+                return;
+            }
+
+            seen = generation_;
+        }
+
+        //- Process own and stolen tasks until all queues are empty
+        int task{0};
+
+        while (nextTask(w, task))
+        {
+            job_(w, task);
+
+            if (--remaining_ == 0)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.notify_all();
+            }
+        }
+    }
+}
+
+
+bool TKC::WorkStealingPool::nextTask(const int w, int& task)
+{
+    //- Own queue, front
+    {
+        TaskQueue& queue = *queues_[w];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.tasks.empty())
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+
+            return true;
+        }
+    }
+
+    //- Steal from the back of the other queues
+    for (int i = 1; i < nThreads_; ++i)
+    {
+        TaskQueue& queue = *queues_[(w + i) % nThreads_];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.tasks.empty())
+        {
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::WorkStealingPool::nThreads() const
+{
+    return nThreads_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,147 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::WorkStealingPool
+
+Description
+    Persistent thread pool with one task queue per worker. The tasks of a
+    run are distributed in contiguous chunks to the queues. A worker takes
+    the tasks of its own queue from the front and, if it is empty, steals
+    tasks from the back of the other queues. Hence, expensive tasks (e.g.
+    igniting cells) do not leave the other workers idle.
+
+    The job gets the worker ID and the task ID, i.e. each worker can use
+    its own scratch data (e.g. a ChemistryWorkspace).
+
+SourceFiles
+    workStealingPool.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef WorkStealingPool_hpp
+#define WorkStealingPool_hpp
+
+#include "definitions.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                       Class WorkStealingPool Declaration
+\*---------------------------------------------------------------------------*/
+
+class WorkStealingPool
+{
+    private:
+
+        //- Task queue of one worker
+        struct TaskQueue
+        {
+            std::mutex mutex;
+            std::deque<int> tasks;
+        };
+
+
+        // Private Data
+
+            //- Number of workers
+            int nThreads_{1};
+
+            //- Worker threads
+            List<std::thread> threads_;
+
+            //- Task queue of each worker
+            List<smartPtr<TaskQueue>> queues_;
+
+            //- Actual job (worker ID, task ID)
+            std::function<void(const int, const int)> job_;
+
+            //- Synchronisation
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            std::condition_variable done_;
+
+            //- Counter of the runs (wakes up the workers)
+            unsigned long generation_{0};
+
+            //- Number of tasks that are not finished
+            std::atomic<int> remaining_{0};
+
+            //- Shut down the workers
+            bool stop_{false};
+
+
+        // Private Member Functions
+
+            //- Main loop of worker w
+            void work(const int);
+
+            //- Get the next task for worker w (own queue first, then steal)
+            bool nextTask(const int, int&);
+
+
+    public:
+
+        //- Constructor, nThreads = 0 uses all hardware threads
+        WorkStealingPool(const int nThreads = 0);
+
+        //- Destructor
+        ~WorkStealingPool();
+
+
+        // Member Functions
+
+            //- Execute job(worker, task) for the tasks 0 ... nTasks-1 and
+            //  return after all tasks are finished
+            void run
+            (
+                const int,
+                const std::function<void(const int, const int)>&
+            );
+
+
+        // Return Functions
+
+            //- Return the number of workers
+            int nThreads() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // WorkStealingPool_hpp included
+
+// ************************************************************************* //
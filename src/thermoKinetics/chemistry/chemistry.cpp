@@ -39,6 +39,9 @@ TKC::Chemistry::Chemistry(const string fileName, const Thermo& thermo)
 
     //- Build the table that contains in which reaction each species is included
     buildSpeciesInReactionTable();
+
+    //- Build the thermo table of the chemistry species (after the check)
+    buildThermoTable();
 }
 
 
@@ -83,7 +86,6 @@ void TKC::Chemistry::checkSpecies() const
 
 // * * * * * * * * * * * * * Calculation Functions * * * * * * * * * * * * * //
 
-/*
 TKC::map<TKC::word, TKC::scalar> TKC::Chemistry::omega
 (
     const scalar T,
@@ -93,25 +95,22 @@ TKC::map<TKC::word, TKC::scalar> TKC::Chemistry::omega
     //- Species
     const wordList& tspecies = species();
 
+    //- Source terms of all species, rates of progress evaluated once
+    scalarField tomega;
+
+    ChemistryCalc::omega(T, con, tomega);
+
     //- Temporary map
     map<word, scalar> dcdt;
 
-    //- Build the map
-    forAll(tspecies, s)
-    {
-        dcdt[s] = scalar(0);
-    }
-
-    forAll(tspecies, s)
+    forEach(tspecies, s)
     {
-        //- Calculate source term omega for species s
-        dcdt[s] = ChemistryCalc::omega(s, T, con);
+        dcdt[tspecies[s]] = tomega[s];
     }
 
     //- Return the rate field
     return dcdt;
 }
-*/
 
 
 // * * * * * * * * * * * * * * * Update Functions  * * * * * * * * * * * * * //
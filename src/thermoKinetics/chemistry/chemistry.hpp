@@ -70,6 +70,7 @@ class Chemistry
 
         // Calculation Functions
 
+            using ChemistryCalc::omega;
 
             //- Calculate the source term of all species (omega) and return it
             //  omega = dcdt
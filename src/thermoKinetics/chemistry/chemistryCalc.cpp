@@ -25,7 +25,12 @@ License
 
 #include "chemistryCalc.hpp"
 #include "constants.hpp"
+#include "matrix.hpp"
+#include "sparseMatrix.hpp"
 #include <math.h>
+#include <limits>
+#include <algorithm>
+#include <atomic>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -50,6 +55,70 @@ const TKC::Thermo TKC::ChemistryCalc::thermo() const
 }
 
 
+void TKC::ChemistryCalc::buildThermoTable()
+{
+    static std::atomic<int> nTables{0};
+
+    thermoTable_.build(thermo_, species());
+
+    //- A new ID invalidates the copies of the threads
+    thermoTableID_ = nTables++;
+}
+
+
+const TKC::ThermoTable& TKC::ChemistryCalc::thermoTable(const scalar T) const
+{
+    //- Copies of the shared coefficients per thread and table, the last
+    //  one is cached
+    thread_local map<int, ThermoTable> tables;
+    thread_local int lastID{-1};
+    thread_local ThermoTable* last{nullptr};
+
+    if (lastID != thermoTableID_)
+    {
+        auto it = tables.find(thermoTableID_);
+
+        if (it == tables.end())
+        {
+            it = tables.emplace(thermoTableID_, thermoTable_).first;
+        }
+
+        lastID = thermoTableID_;
+        last = &it->second;
+    }
+
+    last->update(T);
+
+    return *last;
+}
+
+
+void TKC::ChemistryCalc::updatePLOG() const
+{
+    mechanism().pressure(thermo_.p());
+}
+
+
+void TKC::ChemistryCalc::tabulate
+(
+    const scalar Tmin,
+    const scalar Tmax,
+    const scalar tolerance,
+    const int maxIntervals
+)
+{
+    updatePLOG();
+
+    rateTable_.build(*this, Tmin, Tmax, thermo_.p(), tolerance, maxIntervals);
+}
+
+
+const TKC::RateTable& TKC::ChemistryCalc::rateTable() const
+{
+    return rateTable_;
+}
+
+
 // * * * * * * * * * * * * * Calculation Functions * * * * * * * * * * * * * //
 
 TKC::scalar TKC::ChemistryCalc::kf
@@ -70,54 +139,149 @@ TKC::scalar TKC::ChemistryCalc::kf
         //  + trimolecular reaction [cm^6/mol^2/s]
         const scalarField& arrCoeffs = arrheniusCoeffs(r);
 
-        //- Is a third body collision partner included?
-        if (TBR(r))
+        //- Fall off reactions (Lindemann, TROE and SRI), kf depends on [M]
+        if (LOW(r))
         {
-            //- If no Lindemann formula is used, standard arrhenius
-            if (!LOW(r) && !TROE(r) && !SRI(r))
-            {
-                //- Calculate standard arrhenius
-                return arrhenius(arrCoeffs[0], arrCoeffs[1], arrCoeffs[3], T);
-            }
-            //- Lindemann formulation
-            else if (LOW(r) && !TROE(r))
-            {
-                return Lindemann(r, T, c);
-            }
-            //- TROE formulation
-            else if (LOW(r) && TROE(r) && !SRI(r))
-            {
-
-            }
-            //- SRI formulation
-            else if (LOW(r) && TROE(r) && SRI(r))
-            {
+            scalar dkfdT{0};
+            scalar dkfdM{0};
 
-            }
-            else
-            {
-                Warning
-                (
-                    "Reaction " + elementarReaction(r) + " is not\n    "
-                    "defined regarding the fall off regions. No option fits\n",
-                    __FILE__,
-                    __LINE__
-                );
-            }
+            return fallOff(r, T, M(r, c), dkfdT, dkfdM);
         }
-        //- Standard reaction
-        else
+
+        //- PLOG reactions, interpolated for the actual pressure
+        if (PLOG(r))
         {
-            return arrhenius(arrCoeffs[0], arrCoeffs[1], arrCoeffs[2], T);
+            updatePLOG();
+
+            const ChemistryMechanism& mech = mechanism();
+
+            return arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r], T);
         }
+
+        //- Standard and third body reactions
+        return arrhenius(arrCoeffs[0], arrCoeffs[1], arrCoeffs[2], T);
     }
     else
     {
         return 0;
     }
+}
+
+
+TKC::scalar TKC::ChemistryCalc::kf
+(
+    const int r,
+    const scalar T,
+    const scalarField& c
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    updatePLOG();
+
+    //- Fall off reactions (Lindemann, TROE, SRI)
+    if (mech.type(r) == ChemistryMechanism::fallOff)
+    {
+        scalar dkfdT{0};
+        scalar dkfdM{0};
+
+        return fallOff(r, T, M(r, c), dkfdT, dkfdM);
+    }
+
+    //- Standard arrhenius, pre-exponential factor units depend on reaction
+    return arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r], T);
+}
+
+
+TKC::scalar TKC::ChemistryCalc::kf
+(
+    const int r,
+    const scalar T,
+    const scalarField& c,
+    scalar& dkfdT,
+    scalar& dkfdM
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    updatePLOG();
+
+    //- Fall off reactions, kf depends on [M]
+    if (mech.type(r) == ChemistryMechanism::fallOff)
+    {
+        return fallOff(r, T, M(r, c), dkfdT, dkfdM);
+    }
+
+    //- Standard arrhenius, d(ln k)/dT = (beta + Ta/T)/T
+    const scalar k = arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r], T);
+
+    dkfdT = k * (mech.beta()[r] + mech.Ta()[r]/T) / T;
+    dkfdM = 0;
+
+    return k;
+}
+
+
+void TKC::ChemistryCalc::kf
+(
+    const scalar T,
+    const scalarField& c,
+    scalarField& k
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    //- Standard arrhenius for all reactions in one contiguous sweep,
+    //  interpolated if the rate table is available (PLOG reactions
+    //  depend on the pressure of the table as well)
+    const bool tabulated =
+        mech.plogReac().empty()
+      ? rateTable_.valid(T)
+      : rateTable_.valid(T, thermo_.p());
+
+    if (tabulated)
+    {
+        rateTable_.kf(T, k);
+    }
+    else
+    {
+        arrhenius(T, k);
+    }
 
-    //- Compress compiler warning
-    return 0;
+    //- Fall off reactions in their own stage, kinf is the arrhenius value
+    const List<int>& fallOffReac = mech.fallOffReac();
+
+    if (fallOffReac.empty())
+    {
+        return;
+    }
+
+    const int nF = fallOffReac.size();
+
+    const List<int>& tbIndex = mech.thirdBodyIndex();
+
+    scalarField conMAll;
+    scalarField conM(nF);
+    scalarField kinf(nF);
+    scalarField Pr(nF);
+    scalarField kFallOff(nF);
+
+    M(c, conMAll);
+
+    for (int f = 0; f < nF; ++f)
+    {
+        const int r = fallOffReac[f];
+
+        conM[f] = conMAll[tbIndex[r]];
+        kinf[f] = k[r];
+    }
+
+    fallOff(T, conM, kinf, Pr, kFallOff);
+
+    for (int f = 0; f < nF; ++f)
+    {
+        k[fallOffReac[f]] = kFallOff[f];
+    }
 }
 
 
@@ -147,31 +311,130 @@ TKC::scalar TKC::ChemistryCalc::keq
     const scalar T
 ) const
 {
-    //- Calculate sum of free GIBBS energy of reaction r
-    const scalar deltaG = dg(r, T);
+    const ChemistryMechanism& mech = mechanism();
+
+    //- g0/(RT) of all species, evaluated once per temperature
+    const scalarField& gRT = thermoTable(T).gRT();
 
-    //- Calculate reaction rate constant kp
-    const scalar Kp = exp(-1 * deltaG / (TKC::Constants::R * T ));
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+
+    //- Sum of free GIBBS energy of reaction r at p0, dG0/(RT)
+    scalar dgRT{0};
+
+    for (int i = netStart[r]; i < netStart[r+1]; ++i)
+    {
+        dgRT += netNu[i] * gRT[netID[i]];
+    }
 
     //- Global reaction order == exponent
-    const scalar exponent = globalReactionOrder(r);
+    const scalar exponent = mech.dn()[r];
 
     //- Save some calculation because if exponent == 0 hence keq == kp
     if (exponent == 0)
     {
-        return Kp;
+        return exp(-dgRT);
     }
-    else
+
+    //- Conversion of Kp into Kc [(mol/cm^3)^dn], Kc = Kp (p0/(RT))^dn
+    //  with p0 in [Pa] and R in [cm^3 Pa/K/mol]
+    return
+        exp
+        (
+          - dgRT
+          - exponent*log(TKC::Constants::RcmPa * T / TKC::Constants::p0)
+        );
+}
+
+
+void TKC::ChemistryCalc::keq
+(
+    const scalar T,
+    scalarField& keq
+) const
+{
+    //- Tabulated values if available
+    if (rateTable_.valid(T, thermo_.p()))
     {
-        //- Get the pressure of the calculation
-        const scalar p = thermo_.p();
+        rateTable_.keq(T, keq);
 
-        //- Calculate the equilibrium constant Keq and return it
-        //  In the formulation p is normally in [dyn/cm^2] and R in
-        //  [ergs/K/mol]. We use [Pa] and [J/K/mol] therefore the
-        //  have to multiply R by 1000 | p/R for 1 bar ~ 12.1802
-        //  TODO change R to Rcal
-        return (Kp / pow(TKC::Constants::Rcal * 1e3 / p * T, exponent));
+        return;
+    }
+
+    scalarField dlnKeqdT;
+
+    this->keq(T, keq, dlnKeqdT);
+}
+
+
+void TKC::ChemistryCalc::keq
+(
+    const scalar T,
+    scalarField& keq,
+    scalarField& dlnKeqdT
+) const
+{
+    lnKeq(T, thermo_.p(), keq, dlnKeqdT);
+
+    forAll(keq, K)
+    {
+        K = exp(K);
+    }
+}
+
+
+void TKC::ChemistryCalc::lnKeq
+(
+    const scalar T,
+    const scalar p,
+    scalarField& lnKeq,
+    scalarField& dlnKeqdT
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nR = mech.nReac();
+
+    //- g0/(RT) and h/(RT) of all species, evaluated once per temperature
+    const ThermoTable& table = thermoTable(T);
+    const scalarField& gRT = table.gRT();
+    const scalarField& hRT = table.hRT();
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+    const scalarField& dn = mech.dn();
+
+    //- Conversion of Kp into Kc, ln(p0/(RT)) with R in [cm^3 Pa/K/mol]
+    const scalar lnP0RT =
+        -log(TKC::Constants::RcmPa * T / TKC::Constants::p0);
+
+    lnKeq.resize(nR);
+    dlnKeqdT.resize(nR);
+
+    for (int r = 0; r < nR; ++r)
+    {
+        if (!mech.backward(r))
+        {
+            lnKeq[r] = 0;
+            dlnKeqdT[r] = 0;
+            continue;
+        }
+
+        //- Sparse dot products of the net stochiometry with g0/(RT) and
+        //  h/(RT), d(g0/(RT))/dT = -h/(RT^2)
+        scalar dgRT{0};
+        scalar dhRT{0};
+
+        for (int i = netStart[r]; i < netStart[r+1]; ++i)
+        {
+            dgRT += netNu[i] * gRT[netID[i]];
+            dhRT += netNu[i] * hRT[netID[i]];
+        }
+
+        lnKeq[r] = -dgRT + dn[r]*lnP0RT;
+        dlnKeqdT[r] = (dhRT - dn[r]) / T;
     }
 }
 
@@ -193,18 +456,63 @@ TKC::scalar TKC::ChemistryCalc::arrhenius
 }
 
 
+void TKC::ChemistryCalc::arrhenius
+(
+    const scalar T,
+    scalarField& k
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nR = mech.nReac();
+
+    k.resize(nR);
+
+    updatePLOG();
+
+    //- Log form k = A * exp(beta*lnT - Ta/T), no pow() and no division
+    //  inside the loop. The loop body is branch free and works on plain
+    //  contiguous arrays to give the compiler the chance to vectorize it
+    const scalar lnT = log(T);
+    const scalar rT = 1 / T;
+
+    const scalar* lnA = mech.lnA().data();
+    const scalar* signA = mech.signA().data();
+    const scalar* beta = mech.beta().data();
+    const scalar* Ta = mech.Ta().data();
+    scalar* kr = k.data();
+
+    #pragma omp simd
+    for (int r = 0; r < nR; ++r)
+    {
+        kr[r] = signA[r] * exp(lnA[r] + beta[r]*lnT - Ta[r]*rT);
+    }
+}
+
+
 TKC::scalar TKC::ChemistryCalc::Lindemann
 (
     const int r,
     const scalar T,
     const map<word, scalar>& c
 ) const
+{
+    return Lindemann(r, T, M(r, c));
+}
+
+
+TKC::scalar TKC::ChemistryCalc::Lindemann
+(
+    const int r,
+    const scalar T,
+    const scalar conM
+) const
 {
     const scalarField& arrCoeffs = arrheniusCoeffs(r);
 
     //- Calculate standard arrhenius
     const scalar arrheniusHigh =
-        arrhenius(arrCoeffs[0], arrCoeffs[1], arrCoeffs[3], T);
+        arrhenius(arrCoeffs[0], arrCoeffs[1], arrCoeffs[2], T);
 
     //- Coefficients for low pressure area
     const scalarField& arrCoeffsLow = LOWCoeffs(r);
@@ -219,196 +527,1518 @@ TKC::scalar TKC::ChemistryCalc::Lindemann
             T
         );
 
-    //- Calculate the concentration of the third body partner
-    const scalar conM = M(r, c);
+    //- Reduced pressure
+    const scalar Pr = arrheniusLow * conM / arrheniusHigh;
 
-    //- TODO finish function
-    return 0;
+    return (arrheniusHigh * Pr / (1 + Pr));
 }
 
 
-TKC::scalar TKC::ChemistryCalc::Fcent
+TKC::scalar TKC::ChemistryCalc::fallOff
 (
     const int r,
-    const scalar T
+    const scalar T,
+    const scalar conM,
+    scalar& dkfdT,
+    scalar& dkfdM
 ) const
 {
-    //- TROE coefficients
-    const scalarField& troeCoeffs = TROECoeffs(r);
+    const ChemistryMechanism& mech = mechanism();
 
-    //- Alpha
-    const scalar alpha = troeCoeffs[0];
+    const int f = mech.fallOffIndex()[r];
 
-    //- T***
-    const scalar Tsss = troeCoeffs[1];
+    //- High and low pressure limit and their d(ln k)/dT
+    const scalar kinf =
+        arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r], T);
 
-    //- T*
-    const scalar Ts = troeCoeffs[2];
+    const scalar k0 =
+        arrhenius(mech.lowA()[f], mech.lowBeta()[f], mech.lowEa()[f], T);
 
-    //- T**
-    const scalar Tss = troeCoeffs[3];
+    const scalar dlnkinfdT = (mech.beta()[r] + mech.Ta()[r]/T) / T;
 
-    //- Return Fcent
-    return
-    (
-        (1 - alpha) * exp(-1 * T / Tsss)
-      + alpha * exp(-1 * T / Ts)
-      + exp(-1 * Tss / T)
-    );
-}
+    const scalar dlnk0dT =
+        (mech.lowBeta()[f] + mech.lowEa()[f]/(TKC::Constants::Rcal*T)) / T;
 
+    //- Reduced pressure
+    const scalar Pr = k0 * conM / kinf;
 
-TKC::scalar TKC::ChemistryCalc::Flog
-(
-    const int r,
-    const scalar T,
-    const scalar M
-) const
-{
-    //- a) Calculate Fcent
-    const scalar F_cent = Fcent(r, T);
+    //- Broadening factor
+    scalar dlnFdlnPr{0};
+    scalar dlnFdT{0};
 
-    //- b) Calculate constants
-    const scalar N = 0.75 - 1.27 * log(F_cent);
-    const scalar C = -0.4 - 0.67 * log(F_cent);
+    const scalar F = fallOffF(f, T, Pr, dlnFdlnPr, dlnFdT);
 
-    //- c) Calculate reduced pressure Pr
-    //  + Here we need k for LOW and normal pressure
-    const scalar kinf = kf(r, T);
-    const scalar klow = kf(r, T);
+    //- kf = kinf * Pr/(1+Pr) * F
+    const scalar kf = kinf * Pr / (1 + Pr) * F;
 
-    const scalar Pr = klow * M / kinf;
+    //- d(kf)/d(Pr) written without 1/Pr to be valid for [M] = 0
+    const scalar dkfdPr = kinf * F / (1 + Pr) * (1/(1 + Pr) + dlnFdlnPr);
 
-    //- d) Calculate enumerator
-    const scalar enumerator = log10(F_cent);
+    dkfdM = dkfdPr * k0 / kinf;
 
-    //- e) Calculate denominator
-    const scalar denominator = 1 +
-        pow((log10(Pr) + C)/(N - 0.14 * (log10(Pr) + C)),2);
+    dkfdT =
+        kf * (dlnkinfdT + dlnFdT)
+      + dkfdPr * Pr * (dlnk0dT - dlnkinfdT);
 
-    //- f) Return Flog
-    return (enumerator/denominator);
+    return kf;
 }
 
 
-TKC::scalar TKC::ChemistryCalc::omega
+void TKC::ChemistryCalc::fallOff
 (
-    const word species,
     const scalar T,
-    const map<word, scalar>& con
+    const scalarField& conM,
+    const scalarField& kinf,
+    scalarField& Pr,
+    scalarField& kf
 ) const
 {
+    const ChemistryMechanism& mech = mechanism();
 
-    //- Calculate Omega for species
-    scalar omega{0};
-
-    //- Get reaction no. where species is included
-    const List<int>& inReaction = reacNumbers(species);
+    const int nF = mech.fallOffReac().size();
 
-    //Info<< "Species calculation " << species << "\n"
-    //    << "--------------------------------------\n";
-
-    for(size_t i = 0; i<inReaction.size(); ++i)
-    {
-        //- Elementar Reaction number
-        const size_t r = inReaction[i];
+    Pr.resize(nF);
+    kf.resize(nF);
 
-        //- Calculate the forward and backward reaction rates
-        const scalar kf_ = kf(r, T);
-        const scalar kb_ = kb(r, T);
+    const scalar lnT = log(T);
+    const scalar rT = 1 / T;
 
-        //- Get all species that are acting as products in reaction r
-        const List<word>& prodspecies = products(r);
+    //- Keep the logarithms away from zero
+    const scalar small = std::numeric_limits<scalar>::min();
 
-        //- Get all species that act as educts in reaction r
-        const List<word>& educSpecies = educts(r);
+    //- Rows of each formulation
+    const List<int>& start = mech.fallOffTypeStart();
 
-        //- Stochiometric factors of products
-        map<word, int> nuProd = nuProducts(r);
+    const int troe = ChemistryMechanism::TROE;
+    const int sri = ChemistryMechanism::SRI;
 
-        //- Stochiometric factors of educts
-        map<word, int> nuEduc = nuEducts(r);
+    const scalar* M = conM.data();
+    const scalar* kHigh = kinf.data();
+    scalar* PrPtr = Pr.data();
+    scalar* k = kf.data();
 
-        //- TMP fields
-        scalar prod{1};
-        scalar educ{1};
+    //- a) Low pressure limit, reduced pressure and Lindemann form (F = 1)
+    {
+        const scalar* lnA = mech.lowLnA().data();
+        const scalar* signA = mech.lowSignA().data();
+        const scalar* beta = mech.lowBeta().data();
+        const scalar* Ta = mech.lowTa().data();
 
-        //- Product side, con is in [mol/cm^3]
-        forAll(prodspecies, s)
+        #pragma omp simd
+        for (int f = 0; f < nF; ++f)
         {
-            prod *= pow(con.at(s), nuProd.at(s));
-        }
+            const scalar k0 = signA[f] * exp(lnA[f] + beta[f]*lnT - Ta[f]*rT);
 
-        //- Educt side, con is in [mol/cm^3]
-        //  Note, abs needed
-        forAll(educSpecies, s)
-        {
-            educ *= pow(con.at(s), abs(nuEduc.at(s)));
+            PrPtr[f] = k0 * M[f] / kHigh[f];
+            k[f] = kHigh[f] * PrPtr[f] / (1 + PrPtr[f]);
         }
+    }
 
-        //- Get pre-factor nu'' - nu' :: based on the fact that we already
-        //  know the right value, we just have to check if the species
-        //  is within the product or educt side
-        scalar nuSpecies{0};
+    //- b) TROE broadening, log10(F) = log10(Fcent) / (1 + f1^2)
+    {
+        const scalar* alpha = mech.troeAlpha().data();
+        const scalar* T3 = mech.troeT3().data();
+        const scalar* T1 = mech.troeT1().data();
+        const scalar* T2 = mech.troeT2().data();
 
-        if (nuEduc.count(species) && !nuProd.count(species))
-        {
-            nuSpecies = nuEduc.at(species);
-        }
-        else if (!nuEduc.count(species) && nuProd.count(species))
-        {
-            nuSpecies = nuProd.at(species);
-        }
-        else if (nuEduc.count(species) && nuProd.count(species))
+        #pragma omp simd
+        for (int f = start[troe]; f < start[troe+1]; ++f)
         {
-            nuSpecies = nuProd.at(species) + nuEduc.at(species);
+            //- T** is optional (zero if not given)
+            const scalar Fcent =
+                (1 - alpha[f])*exp(-T/T3[f]) + alpha[f]*exp(-T/T1[f])
+              + (T2[f] != 0 ? exp(-T2[f]*rT) : 0);
+
+            const scalar L = log10(Fcent > small ? Fcent : small);
+            const scalar logPr = log10(PrPtr[f] > small ? PrPtr[f] : small);
+
+            const scalar C = -0.4 - 0.67*L;
+            const scalar N = 0.75 - 1.27*L;
+            const scalar x = logPr + C;
+            const scalar f1 = x / (N - 0.14*x);
+
+            k[f] *= pow(10, L / (1 + f1*f1));
         }
-        else
+    }
+
+    //- c) SRI broadening, F = d * [a exp(-b/T) + exp(-T/c)]^X * T^e
+    {
+        const scalar* a = mech.sriA().data();
+        const scalar* b = mech.sriB().data();
+        const scalar* c = mech.sriC().data();
+        const scalar* d = mech.sriD().data();
+        const scalar* e = mech.sriE().data();
+
+        #pragma omp simd
+        for (int f = start[sri]; f < start[sri+1]; ++f)
         {
-            NotImplemented
-            (
-                __FILE__,
-                __LINE__
-            );
-        }
+            const scalar logPr = log10(PrPtr[f] > small ? PrPtr[f] : small);
+            const scalar X = 1 / (1 + logPr*logPr);
 
-        //Info<<std::setw(30) << chemData.elementarReaction(r)
-        //    <<std::setw(20) << nuSpecies * (kf_ * educ - kb_ * prod)
-        //    << "   "
-        //    << nuSpecies << " *( "
-        //    << kf_ << " * "
-        //    << educ << " - "
-        //    << kb_ << " * "
-        //    << prod << ")\n" ;
-        omega += nuSpecies * (kf_ * educ - kb_ * prod);
+            k[f] *=
+                d[f] * pow(a[f]*exp(-b[f]*rT) + exp(-T/c[f]), X)
+              * exp(e[f]*lnT);
+        }
     }
-
-    return omega;
 }
 
 
-TKC::scalar TKC::ChemistryCalc::M
+TKC::scalar TKC::ChemistryCalc::fallOffF
 (
-    const int r,
-    const map<word, scalar>& c
+    const int f,
+    const scalar T,
+    const scalar Pr,
+    scalar& dlnFdlnPr,
+    scalar& dlnFdT
 ) const
 {
-    //- Tmp M
-    scalar M{0};
+    const ChemistryMechanism& mech = mechanism();
 
-    const map<word, scalar>& enhancedSpecies = ENHANCEDCoeffs(r);
+    //- Keep the logarithms away from zero
+    const scalar small = std::numeric_limits<scalar>::min();
 
-    //- Each species is used as third body partner
+    const scalar logPr = log10(max(Pr, small));
+
+    switch (mech.fallOffType()[f])
     {
-        //- [M] = sum of all concentrations
-        loopMap(species, factor, enhancedSpecies)
+        case ChemistryMechanism::TROE:
         {
-            M += factor * c.at(species);
+            const scalar alpha = mech.troeAlpha()[f];
+            const scalar T3 = mech.troeT3()[f];
+            const scalar T1 = mech.troeT1()[f];
+            const scalar T2 = mech.troeT2()[f];
+
+            //- Fcent and d(Fcent)/dT, T** is optional (zero if not given)
+            scalar Fcent = (1 - alpha)*exp(-T/T3) + alpha*exp(-T/T1);
+
+            scalar dFcentdT =
+              - (1 - alpha)/T3*exp(-T/T3) - alpha/T1*exp(-T/T1);
+
+            if (T2 != 0)
+            {
+                Fcent += exp(-T2/T);
+                dFcentdT += T2/(T*T)*exp(-T2/T);
+            }
+
+            const scalar L = log10(max(Fcent, small));
+
+            //- log10(F) = L / (1 + f1^2), f1 = x / (N - 0.14 x)
+            const scalar C = -0.4 - 0.67*L;
+            const scalar N = 0.75 - 1.27*L;
+            const scalar x = logPr + C;
+            const scalar D = N - 0.14*x;
+            const scalar f1 = x / D;
+            const scalar g = 1 / (1 + f1*f1);
+
+            //- Partial derivatives of f1 with respect to log10(Pr) and L
+            const scalar df1dLogPr = N / (D*D);
+            const scalar df1dL = (-0.67*D - x*(-1.27 + 0.14*0.67)) / (D*D);
+
+            dlnFdlnPr = -2*L*f1*g*g*df1dLogPr;
+
+            dlnFdT = (g - 2*L*f1*g*g*df1dL) * dFcentdT / Fcent;
+
+            return pow(10, L*g);
         }
-    }
 
-    return M;
-}
+        case ChemistryMechanism::SRI:
+        {
+            const scalar a = mech.sriA()[f];
+            const scalar b = mech.sriB()[f];
+            const scalar c = mech.sriC()[f];
+            const scalar d = mech.sriD()[f];
+            const scalar e = mech.sriE()[f];
+
+            //- F = d * [a exp(-b/T) + exp(-T/c)]^X * T^e
+            const scalar X = 1 / (1 + logPr*logPr);
+            const scalar base = a*exp(-b/T) + exp(-T/c);
+            const scalar dbasedT = a*b/(T*T)*exp(-b/T) - exp(-T/c)/c;
+
+            dlnFdlnPr = -2*log(base)*logPr*X*X / log(scalar(10));
+
+            dlnFdT = X*dbasedT/base + e/T;
+
+            return d * pow(base, X) * pow(T, e);
+        }
+
+        default:
+        {
+            //- Lindemann
+            dlnFdlnPr = 0;
+            dlnFdT = 0;
+
+            return 1;
+        }
+    }
+}
+
+
+TKC::scalar TKC::ChemistryCalc::Fcent
+(
+    const int r,
+    const scalar T
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int f = mech.fallOffIndex()[r];
+
+    const scalar alpha = mech.troeAlpha()[f];
+    const scalar T3 = mech.troeT3()[f];
+    const scalar T1 = mech.troeT1()[f];
+    const scalar T2 = mech.troeT2()[f];
+
+    //- T** is optional (zero if not given)
+    scalar Fcent = (1 - alpha)*exp(-T/T3) + alpha*exp(-T/T1);
+
+    if (T2 != 0)
+    {
+        Fcent += exp(-T2/T);
+    }
+
+    return Fcent;
+}
+
+
+TKC::scalar TKC::ChemistryCalc::Flog
+(
+    const int r,
+    const scalar T,
+    const scalar M
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int f = mech.fallOffIndex()[r];
+
+    //- Reduced pressure out of the high and the low pressure limit
+    const scalar kinf =
+        arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r], T);
+
+    const scalar k0 =
+        arrhenius(mech.lowA()[f], mech.lowBeta()[f], mech.lowEa()[f], T);
+
+    const scalar Pr = k0 * M / kinf;
+
+    //- log10(F) of the broadening factor
+    scalar dlnFdlnPr{0};
+    scalar dlnFdT{0};
+
+    return log10(fallOffF(f, T, Pr, dlnFdlnPr, dlnFdT));
+}
+
+
+TKC::scalar TKC::ChemistryCalc::forwardProduct
+(
+    const int r,
+    const scalarField& c
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int* f = &mech.reactantFactor()[3*r];
+
+    switch (mech.reactantOrder()[r])
+    {
+        case 1: return c[f[0]];
+        case 2: return c[f[0]]*c[f[1]];
+        case 3: return c[f[0]]*c[f[1]]*c[f[2]];
+    }
+
+    const List<int>& rStart = mech.reactantStart();
+    const List<int>& rID = mech.reactantID();
+    const List<int>& rNu = mech.reactantNu();
+
+    scalar educ{1};
+
+    for (int i = rStart[r]; i < rStart[r+1]; ++i)
+    {
+        educ *= integerPow(c[rID[i]], rNu[i]);
+    }
+
+    return educ;
+}
+
+
+TKC::scalar TKC::ChemistryCalc::backwardProduct
+(
+    const int r,
+    const scalarField& c
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int* f = &mech.productFactor()[3*r];
+
+    switch (mech.productOrder()[r])
+    {
+        case 1: return c[f[0]];
+        case 2: return c[f[0]]*c[f[1]];
+        case 3: return c[f[0]]*c[f[1]]*c[f[2]];
+    }
+
+    const List<int>& pStart = mech.productStart();
+    const List<int>& pID = mech.productID();
+    const List<int>& pNu = mech.productNu();
+
+    scalar prod{1};
+
+    for (int i = pStart[r]; i < pStart[r+1]; ++i)
+    {
+        prod *= integerPow(c[pID[i]], pNu[i]);
+    }
+
+    return prod;
+}
+
+
+TKC::scalar TKC::ChemistryCalc::rateOfProgress
+(
+    const int r,
+    const scalar T,
+    const map<word, scalar>& con
+) const
+{
+    return rateOfProgress(r, T, mechanism().concentrations(con));
+}
+
+
+TKC::scalar TKC::ChemistryCalc::rateOfProgress
+(
+    const int r,
+    const scalar T,
+    const scalarField& c
+) const
+{
+    //- Forward rate constant is needed for kb in any case
+    const scalar kfr = kf(r, T, c);
+
+    const scalar kbr = mechanism().backward(r) ? kfr / keq(r, T) : 0;
+
+    return rateOfProgress(r, kfr, kbr, c);
+}
+
+
+TKC::scalar TKC::ChemistryCalc::rateOfProgress
+(
+    const int r,
+    const scalar kfr,
+    const scalar kbr,
+    const scalarField& c
+) const
+{
+    const bool thirdBody =
+        mechanism().type(r) == ChemistryMechanism::thirdBody;
+
+    return rateOfProgress(r, kfr, kbr, thirdBody ? M(r, c) : 1, c);
+}
+
+
+TKC::scalar TKC::ChemistryCalc::rateOfProgress
+(
+    const int r,
+    const scalar kfr,
+    const scalar kbr,
+    const scalar conM,
+    const scalarField& c
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    //- Forward and backward reaction rates
+    const scalar kf_ = mech.forward(r) ? kfr : scalar(0);
+    const scalar kb_ = mech.backward(r) ? kbr : scalar(0);
+
+    //- Educt and product side, c is in [mol/cm^3]
+    const scalar educ = forwardProduct(r, c);
+    const scalar prod = backwardProduct(r, c);
+
+    scalar q = kf_ * educ - kb_ * prod;
+
+    //- Third body reaction without fall off, [M] acts as a reactant
+    if (mech.type(r) == ChemistryMechanism::thirdBody)
+    {
+        q *= conM;
+    }
+
+    return q;
+}
+
+
+void TKC::ChemistryCalc::rateOfProgress
+(
+    const scalar T,
+    const map<word, scalar>& con,
+    scalarField& q
+) const
+{
+    rateOfProgress(T, mechanism().concentrations(con), q);
+}
+
+
+void TKC::ChemistryCalc::rateOfProgress
+(
+    const scalar T,
+    const scalarField& c,
+    scalarField& q
+) const
+{
+    //- Forward rate constants and equilibrium constants of all reactions
+    scalarField k;
+    scalarField K;
+
+    kf(T, c, k);
+    keq(T, K);
+
+    //- [M] of all third body reactions
+    scalarField conM;
+
+    M(c, conM);
+
+    const List<int>& tbIndex = mechanism().thirdBodyIndex();
+
+    q.resize(k.size());
+
+    forEach(k, r)
+    {
+        const int tb = tbIndex[r];
+
+        q[r] = rateOfProgress(r, k[r], k[r]/K[r], tb != -1 ? conM[tb] : 1, c);
+    }
+}
+
+
+TKC::scalar TKC::ChemistryCalc::omega
+(
+    const word species,
+    const scalar T,
+    const map<word, scalar>& con
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    //- Species ID and concentration field
+    const int s = mech.speciesID(species);
+    const scalarField c = mech.concentrations(con);
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+    const List<int>& start = mech.speciesReacStart();
+    const List<int>& reacID = mech.speciesReacID();
+
+    //- Calculate Omega for species
+    scalar omega{0};
+
+    //- Loop over all reactions in which species s is included
+    for (int i = start[s]; i < start[s+1]; ++i)
+    {
+        const int r = reacID[i];
+
+        //- Get pre-factor nu'' - nu'
+        for (int j = netStart[r]; j < netStart[r+1]; ++j)
+        {
+            if (netID[j] == s)
+            {
+                omega += netNu[j] * rateOfProgress(r, T, c);
+            }
+        }
+    }
+
+    return omega;
+}
+
+
+void TKC::ChemistryCalc::omega
+(
+    const scalar T,
+    const map<word, scalar>& con,
+    scalarField& omega
+) const
+{
+    this->omega(T, mechanism().concentrations(con), omega);
+}
+
+
+void TKC::ChemistryCalc::omega
+(
+    const scalar T,
+    const scalarField& c,
+    scalarField& omega
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+
+    //- Rates of progress of all reactions, each one evaluated once
+    scalarField q;
+
+    rateOfProgress(T, c, q);
+
+    //- Scatter the rates to the species: omega_s = sum_r (nu''-nu') q_r
+    omega.assign(mech.nSpecies(), scalar(0));
+
+    forEach(q, r)
+    {
+        for (int i = netStart[r]; i < netStart[r+1]; ++i)
+        {
+            omega[netID[i]] += netNu[i] * q[r];
+        }
+    }
+}
+
+
+void TKC::ChemistryCalc::omega
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& omega
+) const
+{
+    const int N = T.size();
+
+    omega.assign(mechanism().nSpecies(), scalarField(N, 0));
+
+    ChemistryWorkspace ws;
+
+    this->omega(T, p, c, omega, 0, N, ws);
+}
+
+
+void TKC::ChemistryCalc::omega
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& omega,
+    const int begin,
+    const int end,
+    ChemistryWorkspace& ws
+) const
+{
+    sourceTerms(T, p, c, begin, end, nullptr, nullptr, &omega, nullptr, ws);
+}
+
+
+void TKC::ChemistryCalc::omega
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& omega,
+    const int begin,
+    const int end,
+    const List<int>& species,
+    const List<int>& reactions,
+    ChemistryWorkspace& ws
+) const
+{
+    sourceTerms(T, p, c, begin, end, &species, &reactions, &omega, nullptr, ws);
+}
+
+
+void TKC::ChemistryCalc::rateOfProgress
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& q,
+    const int begin,
+    const int end,
+    ChemistryWorkspace& ws
+) const
+{
+    sourceTerms(T, p, c, begin, end, nullptr, nullptr, nullptr, &q, ws);
+}
+
+
+void TKC::ChemistryCalc::rateOfProgress
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& q,
+    const int begin,
+    const int end,
+    const List<int>& species,
+    const List<int>& reactions,
+    ChemistryWorkspace& ws
+) const
+{
+    sourceTerms
+    (
+        T, p, c, begin, end, &species, &reactions, nullptr, &q, ws
+    );
+}
+
+
+void TKC::ChemistryCalc::sourceTerms
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    const int begin,
+    const int end,
+    const List<int>* species,
+    const List<int>* reactions,
+    List<scalarField>* omega,
+    List<scalarField>* q,
+    ChemistryWorkspace& ws
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nS = mech.nSpecies();
+    const int nR = mech.nReac();
+
+    //- Number of states in the block [begin, end)
+    const int N = end - begin;
+
+    //- Fall off reactions (rows grouped by formulation)
+    const List<int>& fallOffReac = mech.fallOffReac();
+    const List<int>& fallOffIndex = mech.fallOffIndex();
+    const int nF = fallOffReac.size();
+
+    ws.resize(nS, N, nF);
+
+    //- Stochiometry
+    const List<int>& rStart = mech.reactantStart();
+    const List<int>& rID = mech.reactantID();
+    const List<int>& rNu = mech.reactantNu();
+    const List<int>& pStart = mech.productStart();
+    const List<int>& pID = mech.productID();
+    const List<int>& pNu = mech.productNu();
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+
+    //- Classified concentration products
+    const List<int>& rOrder = mech.reactantOrder();
+    const List<int>& rFactor = mech.reactantFactor();
+    const List<int>& pOrder = mech.productOrder();
+    const List<int>& pFactor = mech.productFactor();
+
+    auto products = [&]
+    (
+        const int order,
+        const int* f,
+        const int first,
+        const int last,
+        const List<int>& id,
+        const List<int>& nu,
+        scalar* x
+    )
+    {
+        switch (order)
+        {
+            case 1:
+            {
+                const scalar* c0 = c[f[0]].data() + begin;
+
+                std::copy(c0, c0 + N, x);
+
+                break;
+            }
+
+            case 2:
+            {
+                const scalar* c0 = c[f[0]].data() + begin;
+                const scalar* c1 = c[f[1]].data() + begin;
+
+                for (int n = 0; n < N; ++n)
+                {
+                    x[n] = c0[n]*c1[n];
+                }
+
+                break;
+            }
+
+            case 3:
+            {
+                const scalar* c0 = c[f[0]].data() + begin;
+                const scalar* c1 = c[f[1]].data() + begin;
+                const scalar* c2 = c[f[2]].data() + begin;
+
+                for (int n = 0; n < N; ++n)
+                {
+                    x[n] = c0[n]*c1[n]*c2[n];
+                }
+
+                break;
+            }
+
+            default:
+            {
+                std::fill(x, x + N, 1);
+
+                for (int i = first; i < last; ++i)
+                {
+                    const scalar* cj = c[id[i]].data() + begin;
+
+                    for (int k = 0; k < nu[i]; ++k)
+                    {
+                        for (int n = 0; n < N; ++n)
+                        {
+                            x[n] *= cj[n];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    //- Third body efficiencies (default plus sparse deltas)
+    const List<int>& tbIndex = mech.thirdBodyIndex();
+    const List<int>& enhStart = mech.enhancedStart();
+    const List<int>& enhID = mech.enhancedID();
+    const scalarField& enhDelta = mech.enhancedDelta();
+
+    //- PLOG row of each reaction
+    const List<int>& plogIndex = mech.plogIndex();
+
+    //- Workspace of the block
+    scalar* kf = ws.kf.data();
+    scalar* kb = ws.kb.data();
+    scalar* conM = ws.conM.data();
+    scalar* educ = ws.educ.data();
+    scalar* prod = ws.prod.data();
+    const scalar* lnT = ws.lnT.data();
+    const scalar* rT = ws.rT.data();
+    const scalar* lnP0RT = ws.lnP0RT.data();
+    scalar* cTotal = ws.cTotal.data();
+
+    //- Standard arrhenius of reaction r for all states, PLOG reactions are
+    //  interpolated for the pressure of each state
+    const auto arrheniusStates = [&](const int r, scalar* k)
+    {
+        const int pl = plogIndex[r];
+
+        if (pl != -1)
+        {
+            for (int n = 0; n < N; ++n)
+            {
+                scalar lnA{0};
+                scalar beta{0};
+                scalar Ta{0};
+
+                mech.plog(pl, log(p[begin+n]), lnA, beta, Ta);
+
+                k[n] = exp(lnA + beta*lnT[n] - Ta*rT[n]);
+            }
+
+            return;
+        }
+
+        const scalar lnA = mech.lnA()[r];
+        const scalar signA = mech.signA()[r];
+        const scalar beta = mech.beta()[r];
+        const scalar Ta = mech.Ta()[r];
+
+        #pragma omp simd
+        for (int n = 0; n < N; ++n)
+        {
+            k[n] = signA * exp(lnA + beta*lnT[n] - Ta*rT[n]);
+        }
+    };
+
+    //- [M] of third body row tb for all states, default efficiency times
+    //  the total concentration plus the sparse deltas
+    const auto thirdBodyStates = [&](const int tb, scalar* M)
+    {
+        const scalar def = mech.thirdBodyDefault()[tb];
+
+        for (int n = 0; n < N; ++n)
+        {
+            M[n] = def * cTotal[n];
+        }
+
+        for (int i = enhStart[tb]; i < enhStart[tb+1]; ++i)
+        {
+            const scalar delta = enhDelta[i];
+            const scalar* cj = c[enhID[i]].data() + begin;
+
+            for (int n = 0; n < N; ++n)
+            {
+                M[n] += delta * cj[n];
+            }
+        }
+    };
+
+    //- Terms that only depend on the state
+    for (int n = 0; n < N; ++n)
+    {
+        const scalar Tn = T[begin+n];
+
+        ws.T[n] = Tn;
+        ws.lnT[n] = log(Tn);
+        ws.rT[n] = 1 / Tn;
+        ws.lnP0RT[n] =
+            -log(TKC::Constants::RcmPa * Tn / TKC::Constants::p0);
+    }
+
+    //- Total concentration of the states
+    std::fill(cTotal, cTotal + N, 0);
+
+    for (int s = 0; s < nS; ++s)
+    {
+        const scalar* cs = c[s].data() + begin;
+
+        for (int n = 0; n < N; ++n)
+        {
+            cTotal[n] += cs[n];
+        }
+
+        //- Reset the source terms of the block
+        if (omega)
+        {
+            scalarField& w = (*omega)[s];
+
+            std::fill(w.begin() + begin, w.begin() + end, 0);
+        }
+    }
+
+    //- g0/(RT) of the (active) species for all states
+    const int nActiveSpecies = species ? species->size() : nS;
+
+    for (int i = 0; i < nActiveSpecies; ++i)
+    {
+        const int s = species ? (*species)[i] : i;
+
+        thermoTable_.gRT(s, ws.T, ws.lnT, ws.gRT[s]);
+    }
+
+    //- Loop over the (active) reactions
+    const int nActive = reactions ? reactions->size() : nR;
+
+    //- Fall off rows of the evaluated reactions in their own stage: kinf
+    //  and [M] for all states, then the grouped kernels (see
+    //  fallOffStates)
+    List<int>& fallOffRows = ws.fallOffRows;
+
+    fallOffRows.clear();
+
+    for (int j = 0; j < nActive && nF > 0; ++j)
+    {
+        const int f = fallOffIndex[reactions ? (*reactions)[j] : j];
+
+        if (f != -1)
+        {
+            fallOffRows.push_back(f);
+        }
+    }
+
+    std::sort(fallOffRows.begin(), fallOffRows.end());
+
+    forAll(fallOffRows, f)
+    {
+        const int r = fallOffReac[f];
+
+        arrheniusStates(r, ws.kFallOff[f].data());
+        thirdBodyStates(tbIndex[r], ws.conMFallOff[f].data());
+    }
+
+    fallOffStates(fallOffRows, N, ws);
+
+    for (int j = 0; j < nActive; ++j)
+    {
+        const int r = reactions ? (*reactions)[j] : j;
+
+        //- Fall off reactions out of their stage, all others are
+        //  standard arrhenius
+        const int f = fallOffIndex[r];
+
+        if (f != -1)
+        {
+            const scalar* k = ws.kFallOff[f].data();
+
+            std::copy(k, k + N, kf);
+        }
+        else
+        {
+            arrheniusStates(r, kf);
+        }
+
+        //- [M] of third body reactions
+        if (mech.type(r) == ChemistryMechanism::thirdBody)
+        {
+            thirdBodyStates(tbIndex[r], conM);
+        }
+
+        //- Backward rates out of the sparse net stochiometry
+        if (mech.backward(r))
+        {
+            const scalar dn = mech.dn()[r];
+
+            for (int n = 0; n < N; ++n)
+            {
+                kb[n] = dn*lnP0RT[n];
+            }
+
+            for (int i = netStart[r]; i < netStart[r+1]; ++i)
+            {
+                const scalar nu = netNu[i];
+                const scalar* g = ws.gRT[netID[i]].data();
+
+                for (int n = 0; n < N; ++n)
+                {
+                    kb[n] -= nu * g[n];
+                }
+            }
+
+            //- kb = kf / keq
+            #pragma omp simd
+            for (int n = 0; n < N; ++n)
+            {
+                kb[n] = kf[n] * exp(-kb[n]);
+            }
+        }
+        else
+        {
+            std::fill(kb, kb + N, 0);
+        }
+
+        if (!mech.forward(r))
+        {
+            std::fill(kf, kf + N, 0);
+        }
+
+        //- Products of the concentrations, the classified sides are
+        //  written directly out of their factors
+        products
+        (
+            rOrder[r], &rFactor[3*r], rStart[r], rStart[r+1], rID, rNu,
+            educ
+        );
+
+        products
+        (
+            pOrder[r], &pFactor[3*r], pStart[r], pStart[r+1], pID, pNu,
+            prod
+        );
+
+        //- Rate of progress (stored in educ)
+        for (int n = 0; n < N; ++n)
+        {
+            educ[n] = kf[n]*educ[n] - kb[n]*prod[n];
+        }
+
+        if (mech.type(r) == ChemistryMechanism::thirdBody)
+        {
+            for (int n = 0; n < N; ++n)
+            {
+                educ[n] *= conM[n];
+            }
+        }
+
+        if (q)
+        {
+            std::copy(educ, educ + N, (*q)[r].begin() + begin);
+        }
+
+        //- Scatter to the species
+        if (omega)
+        {
+            for (int i = netStart[r]; i < netStart[r+1]; ++i)
+            {
+                const scalar nu = netNu[i];
+                scalar* w = (*omega)[netID[i]].data() + begin;
+
+                for (int n = 0; n < N; ++n)
+                {
+                    w[n] += nu * educ[n];
+                }
+            }
+        }
+    }
+}
+
+
+void TKC::ChemistryCalc::fallOffStates
+(
+    const List<int>& rows,
+    const int N,
+    ChemistryWorkspace& ws
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    //- Keep the logarithms away from zero
+    const scalar small = std::numeric_limits<scalar>::min();
+
+    const scalar* T = ws.T.data();
+    const scalar* lnT = ws.lnT.data();
+    const scalar* rT = ws.rT.data();
+
+    //- Positions [first, last) of the rows of a formulation in rows
+    const List<int>& start = mech.fallOffTypeStart();
+
+    const auto range = [&](const int type, int& first, int& last)
+    {
+        first =
+            std::lower_bound(rows.begin(), rows.end(), start[type])
+          - rows.begin();
+
+        last =
+            std::lower_bound(rows.begin(), rows.end(), start[type+1])
+          - rows.begin();
+    };
+
+    int first{0};
+    int last{0};
+
+    //- a) Low pressure limit, reduced pressure and Lindemann form (F = 1)
+    forAll(rows, f)
+    {
+        const scalar lnA = mech.lowLnA()[f];
+        const scalar signA = mech.lowSignA()[f];
+        const scalar beta = mech.lowBeta()[f];
+        const scalar Ta = mech.lowTa()[f];
+
+        scalar* k = ws.kFallOff[f].data();
+        scalar* Pr = ws.conMFallOff[f].data();
+
+        #pragma omp simd
+        for (int n = 0; n < N; ++n)
+        {
+            const scalar k0 = signA * exp(lnA + beta*lnT[n] - Ta*rT[n]);
+
+            Pr[n] = k0 * Pr[n] / k[n];
+            k[n] *= Pr[n] / (1 + Pr[n]);
+        }
+    }
+
+    //- b) TROE broadening, log10(F) = log10(Fcent) / (1 + f1^2)
+    range(ChemistryMechanism::TROE, first, last);
+
+    for (int i = first; i < last; ++i)
+    {
+        const int f = rows[i];
+
+        const scalar alpha = mech.troeAlpha()[f];
+        const scalar T3 = mech.troeT3()[f];
+        const scalar T1 = mech.troeT1()[f];
+        const scalar T2 = mech.troeT2()[f];
+
+        scalar* k = ws.kFallOff[f].data();
+        const scalar* Pr = ws.conMFallOff[f].data();
+
+        #pragma omp simd
+        for (int n = 0; n < N; ++n)
+        {
+            //- T** is optional (zero if not given)
+            const scalar Fcent =
+                (1 - alpha)*exp(-T[n]/T3) + alpha*exp(-T[n]/T1)
+              + (T2 != 0 ? exp(-T2*rT[n]) : 0);
+
+            const scalar L = log10(Fcent > small ? Fcent : small);
+            const scalar logPr = log10(Pr[n] > small ? Pr[n] : small);
+
+            const scalar C = -0.4 - 0.67*L;
+            const scalar Nf = 0.75 - 1.27*L;
+            const scalar x = logPr + C;
+            const scalar f1 = x / (Nf - 0.14*x);
+
+            k[n] *= pow(10, L / (1 + f1*f1));
+        }
+    }
+
+    //- c) SRI broadening, F = d * [a exp(-b/T) + exp(-T/c)]^X * T^e
+    range(ChemistryMechanism::SRI, first, last);
+
+    for (int i = first; i < last; ++i)
+    {
+        const int f = rows[i];
+
+        const scalar a = mech.sriA()[f];
+        const scalar b = mech.sriB()[f];
+        const scalar c = mech.sriC()[f];
+        const scalar d = mech.sriD()[f];
+        const scalar e = mech.sriE()[f];
+
+        scalar* k = ws.kFallOff[f].data();
+        const scalar* Pr = ws.conMFallOff[f].data();
+
+        #pragma omp simd
+        for (int n = 0; n < N; ++n)
+        {
+            const scalar logPr = log10(Pr[n] > small ? Pr[n] : small);
+            const scalar X = 1 / (1 + logPr*logPr);
+
+            k[n] *=
+                d * pow(a*exp(-b*rT[n]) + exp(-T[n]/c), X)
+              * exp(e*lnT[n]);
+        }
+    }
+}
+
+
+void TKC::ChemistryCalc::rateOfProgressDerivatives
+(
+    const scalar T,
+    const scalarField& c,
+    List<int>& start,
+    List<int>& id,
+    scalarField& dqdc,
+    scalarField& dqdT
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nR = mech.nReac();
+
+    //- Equilibrium constants and d(ln Keq)/dT of all reactions
+    scalarField K;
+    scalarField dlnKdT;
+
+    keq(T, K, dlnKdT);
+
+    //- Stochiometry
+    const List<int>& rStart = mech.reactantStart();
+    const List<int>& rID = mech.reactantID();
+    const List<int>& rNu = mech.reactantNu();
+    const List<int>& pStart = mech.productStart();
+    const List<int>& pID = mech.productID();
+    const List<int>& pNu = mech.productNu();
+
+    //- Third body efficiencies
+    const List<int>& tbIndex = mech.thirdBodyIndex();
+    const List<int>& effStart = mech.efficiencyStart();
+    const List<int>& effID = mech.efficiencyID();
+    const scalarField& eff = mech.efficiency();
+
+    start.assign(1, 0);
+    id.clear();
+    dqdc.clear();
+    dqdT.assign(nR, 0);
+
+    for (int r = 0; r < nR; ++r)
+    {
+        //- Rate constants and their derivatives
+        scalar dkfdT{0};
+        scalar dkfdM{0};
+
+        const scalar kfr = kf(r, T, c, dkfdT, dkfdM);
+
+        const scalar kf_ = mech.forward(r) ? kfr : scalar(0);
+        const scalar kb_ = mech.backward(r) ? kfr / K[r] : scalar(0);
+
+        const scalar dkf_dT = mech.forward(r) ? dkfdT : scalar(0);
+        const scalar dkb_dT =
+            mech.backward(r) ? (dkfdT - kfr*dlnKdT[r]) / K[r] : scalar(0);
+
+        //- Products of the concentrations
+        const scalar educ = forwardProduct(r, c);
+        const scalar prod = backwardProduct(r, c);
+
+        //- [M] as reactant of a pure third body reaction
+        const bool thirdBody = mech.type(r) == ChemistryMechanism::thirdBody;
+        const scalar conM = thirdBody ? M(r, c) : scalar(1);
+
+        //- d(q)/dT at constant concentrations
+        dqdT[r] = (dkf_dT*educ - dkb_dT*prod) * conM;
+
+        //- d(q)/dc_j of the mass action law, the product is derived with
+        //  respect to each entry (no division by c_j, valid for c_j = 0)
+        for (int i = rStart[r]; i < rStart[r+1]; ++i)
+        {
+            scalar d = rNu[i] * integerPow(c[rID[i]], rNu[i]-1);
+
+            for (int j = rStart[r]; j < rStart[r+1]; ++j)
+            {
+                if (j != i)
+                {
+                    d *= integerPow(c[rID[j]], rNu[j]);
+                }
+            }
+
+            id.push_back(rID[i]);
+            dqdc.push_back(kf_ * d * conM);
+        }
+
+        for (int i = pStart[r]; i < pStart[r+1]; ++i)
+        {
+            scalar d = pNu[i] * integerPow(c[pID[i]], pNu[i]-1);
+
+            for (int j = pStart[r]; j < pStart[r+1]; ++j)
+            {
+                if (j != i)
+                {
+                    d *= integerPow(c[pID[j]], pNu[j]);
+                }
+            }
+
+            id.push_back(pID[i]);
+            dqdc.push_back(-kb_ * d * conM);
+        }
+
+        //- Contribution of [M] = sum_j eff_j c_j
+        //  + third body: q = [M] q0 -> d(q)/d(c_j) = eff_j q0
+        //  + fall off: kf([M]) -> d(q)/d(c_j) = eff_j dkf/d[M] (...)
+        const int tb = tbIndex[r];
+
+        if (tb != -1)
+        {
+            scalar dqdM{0};
+
+            if (thirdBody)
+            {
+                dqdM = kf_*educ - kb_*prod;
+            }
+            else if (mech.type(r) == ChemistryMechanism::fallOff)
+            {
+                dqdM =
+                    (mech.forward(r) ? dkfdM*educ : scalar(0))
+                  - (mech.backward(r) ? dkfdM/K[r]*prod : scalar(0));
+            }
+
+            for (int i = effStart[tb]; i < effStart[tb+1]; ++i)
+            {
+                id.push_back(effID[i]);
+                dqdc.push_back(eff[i] * dqdM);
+            }
+        }
+
+        start.push_back(id.size());
+    }
+}
+
+
+void TKC::ChemistryCalc::jacobian
+(
+    const scalar T,
+    const scalarField& c,
+    Matrix& dwdc,
+    scalarField& dwdT
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nS = mech.nSpecies();
+
+    if (dwdc.rows() != size_t(nS) || dwdc.cols() != size_t(nS))
+    {
+        ErrorMsg
+        (
+            "    The Jacobian matrix has to be of size nSpecies x nSpecies ("
+            + toStr(nS) + " x " + toStr(nS) + ")",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    //- Derivatives of the rates of progress
+    List<int> start;
+    List<int> id;
+    scalarField dqdc;
+    scalarField dqdT;
+
+    rateOfProgressDerivatives(T, c, start, id, dqdc, dqdT);
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+
+    dwdc.reset();
+    dwdT.assign(nS, 0);
+
+    //- d(omega_s)/dx = sum_r (nu''-nu')_s d(q_r)/dx
+    forEach(dqdT, r)
+    {
+        for (int i = netStart[r]; i < netStart[r+1]; ++i)
+        {
+            const int s = netID[i];
+
+            dwdT[s] += netNu[i] * dqdT[r];
+
+            for (int j = start[r]; j < start[r+1]; ++j)
+            {
+                dwdc(s, id[j]) += netNu[i] * dqdc[j];
+            }
+        }
+    }
+}
+
+
+void TKC::ChemistryCalc::jacobian
+(
+    const scalar T,
+    const scalarField& c,
+    mapList<int, scalar>& dwdc,
+    scalarField& dwdT
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nS = mech.nSpecies();
+
+    //- Derivatives of the rates of progress
+    List<int> start;
+    List<int> id;
+    scalarField dqdc;
+    scalarField dqdT;
+
+    rateOfProgressDerivatives(T, c, start, id, dqdc, dqdT);
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+
+    dwdc.assign(nS, map<int, scalar>());
+    dwdT.assign(nS, 0);
+
+    //- d(omega_s)/dx = sum_r (nu''-nu')_s d(q_r)/dx, only non-zeros
+    forEach(dqdT, r)
+    {
+        for (int i = netStart[r]; i < netStart[r+1]; ++i)
+        {
+            const int s = netID[i];
+
+            dwdT[s] += netNu[i] * dqdT[r];
+
+            for (int j = start[r]; j < start[r+1]; ++j)
+            {
+                dwdc[s][id[j]] += netNu[i] * dqdc[j];
+            }
+        }
+    }
+}
+
+
+void TKC::ChemistryCalc::jacobian
+(
+    const scalar T,
+    const scalarField& c,
+    SparseMatrix& dwdc,
+    scalarField& dwdT
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const int nS = mech.nSpecies();
+
+    //- Symbolic structure is only copied once
+    if (dwdc.rows() != size_t(nS))
+    {
+        dwdc = mech.jacobianPattern();
+    }
+
+    //- Derivatives of the rates of progress
+    List<int> start;
+    List<int> id;
+    scalarField dqdc;
+    scalarField dqdT;
+
+    rateOfProgressDerivatives(T, c, start, id, dqdc, dqdT);
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netNu = mech.netNu();
+    const List<int>& netID = mech.netID();
+    const List<int>& addr = mech.jacobianAddr();
+
+    dwdc.reset();
+    dwdT.assign(nS, 0);
+
+    scalarField& values = dwdc.values();
+
+    //- Refill the values, the addressing follows the loop order
+    int a{0};
+
+    forEach(dqdT, r)
+    {
+        for (int i = netStart[r]; i < netStart[r+1]; ++i)
+        {
+            dwdT[netID[i]] += netNu[i] * dqdT[r];
+
+            for (int j = start[r]; j < start[r+1]; ++j)
+            {
+                values[addr[a++]] += netNu[i] * dqdc[j];
+            }
+        }
+    }
+}
+
+
+TKC::scalar TKC::ChemistryCalc::M
+(
+    const int r,
+    const map<word, scalar>& c
+) const
+{
+    return M(r, mechanism().concentrations(c));
+}
+
+
+TKC::scalar TKC::ChemistryCalc::M
+(
+    const int r,
+    const scalarField& c
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    //- Row of reaction r in the efficiency table
+    const int tb = mech.thirdBodyIndex()[r];
+
+    const List<int>& start = mech.efficiencyStart();
+    const List<int>& id = mech.efficiencyID();
+    const scalarField& eff = mech.efficiency();
+
+    //- Tmp M
+    scalar M{0};
+
+    //- [M] = sum of all concentrations weighted by their efficiency
+    for (int i = start[tb]; i < start[tb+1]; ++i)
+    {
+        M += eff[i] * c[id[i]];
+    }
+
+    return M;
+}
+
+
+void TKC::ChemistryCalc::M
+(
+    const scalarField& c,
+    scalarField& conM
+) const
+{
+    const ChemistryMechanism& mech = mechanism();
+
+    const scalarField& def = mech.thirdBodyDefault();
+    const List<int>& start = mech.enhancedStart();
+    const List<int>& id = mech.enhancedID();
+    const scalarField& delta = mech.enhancedDelta();
+
+    const int nTB = def.size();
+
+    conM.resize(nTB);
+
+    //- Total concentration, shared by all third body reactions
+    scalar cTotal{0};
+
+    forAll(c, cj)
+    {
+        cTotal += cj;
+    }
+
+    //- Default efficiency and the sparse deltas of the enhanced species
+    for (int tb = 0; tb < nTB; ++tb)
+    {
+        scalar M = def[tb] * cTotal;
+
+        for (int i = start[tb]; i < start[tb+1]; ++i)
+        {
+            M += delta[i] * c[id[i]];
+        }
+
+        conM[tb] = M;
+    }
+}
+
 
 TKC::scalar TKC::ChemistryCalc::dh
 (
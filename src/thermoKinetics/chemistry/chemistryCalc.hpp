@@ -36,6 +36,9 @@ SourceFiles
 #define ChemistryCalc_hpp
 
 #include "chemistryData.hpp"
+#include "thermoTable.hpp"
+#include "rateTable.hpp"
+#include "chemistryWorkspace.hpp"
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
 
@@ -43,6 +46,8 @@ namespace TKC
 {
 
 class Thermo;
+class Matrix;
+class SparseMatrix;
 
 /*---------------------------------------------------------------------------*\
                             Class ChemistryCalc Declaration
@@ -61,6 +66,60 @@ class ChemistryCalc
             const Thermo& thermo_;
 
 
+        // Private workspace
+
+            //- Thermo coefficients of the chemistry species (ordered by
+            //  species ID); each thread evaluates its own copy of it for
+            //  the temperature (see thermoTable())
+            ThermoTable thermoTable_;
+
+            //- Unique ID of the built table (key of the thread copies)
+            int thermoTableID_{-1};
+
+            //- Optional tabulated kf and keq
+            RateTable rateTable_;
+
+
+        // Private Member Functions
+
+            //- SoA kernel for the states [begin, end): evaluates the given
+            //  reactions (all if nullptr) and needs g0/(RT) only of the
+            //  given species (all if nullptr); the rates of progress are
+            //  scattered to omega and/or stored in q if not nullptr
+            void sourceTerms
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                const int,
+                const int,
+                const List<int>*,
+                const List<int>*,
+                List<scalarField>*,
+                List<scalarField>*,
+                ChemistryWorkspace&
+            ) const;
+
+            //- SoA fall off stage of sourceTerms for the N states of the
+            //  workspace: kf of the given fall off rows (sorted, hence the
+            //  rows of each formulation are contiguous); kFallOff holds
+            //  kinf on input and kf on output, conMFallOff [M] on input
+            //  and Pr on output. The states are the inner loop of the
+            //  Lindemann, TROE and SRI passes (vectorized across states)
+            void fallOffStates
+            (
+                const List<int>&,
+                const int,
+                ChemistryWorkspace&
+            ) const;
+
+            //- Product of the educt and product concentrations of reaction
+            //  r; the sides classified with an order <= 3 are expanded
+            //  into single factors, all others use integerPow
+            scalar forwardProduct(const int, const scalarField&) const;
+            scalar backwardProduct(const int, const scalarField&) const;
+
+
     public:
 
         //- Constructor
@@ -75,6 +134,33 @@ class ChemistryCalc
             //- Return the reference to the Thermo object
             const Thermo thermo() const;
 
+            //- Build the thermo table for the chemistry species
+            //  Note: all species have to be available in the thermo object
+            void buildThermoTable();
+
+            //- Return the thermo table evaluated for temperature T; the
+            //  table is local to the calling thread (reentrant)
+            const ThermoTable& thermoTable(const scalar) const;
+
+            //- Resolve the PLOG reactions of the mechanism for the actual
+            //  pressure of the thermo object (only if it changed)
+            void updatePLOG() const;
+
+            //- Tabulate ln(kf) and ln(keq) of all reactions for the
+            //  temperature range [Tmin, Tmax] and the actual pressure; the
+            //  grid is refined until the error of ln(k) is below the
+            //  tolerance. The batched kf and keq use the table afterwards
+            void tabulate
+            (
+                const scalar,
+                const scalar,
+                const scalar,
+                const int maxIntervals = 4096
+            );
+
+            //- Return the rate table
+            const RateTable& rateTable() const;
+
 
         // Calculation Functions
 
@@ -95,6 +181,27 @@ class ChemistryCalc
                 const bool kb = false
             ) const;
 
+            //- Calculate reaction rate kf out of the compiled mechanism for
+            //  the concentration field c (ordered by species ID),
+            //  regardless of the reaction direction
+            scalar kf(const int, const scalar, const scalarField&) const;
+
+            //- Calculate reaction rate kf of reaction r out of the compiled
+            //  mechanism and its derivatives d(kf)/dT and d(kf)/d[M]
+            scalar kf
+            (
+                const int,
+                const scalar,
+                const scalarField&,
+                scalar&,
+                scalar&
+            ) const;
+
+            //- Calculate kf of all reactions at once for the concentration
+            //  field c (ordered by species ID), regardless of the direction;
+            //  the arrhenius part is interpolated if tabulated
+            void kf(const scalar, const scalarField&, scalarField&) const;
+
             //- Calculate reaction rate kb
             scalar kb
             (
@@ -106,6 +213,26 @@ class ChemistryCalc
             //- Calculate equilibrium reaction rate keq
             scalar keq(const int, const scalar) const;
 
+            //- Calculate keq of all reactions at once out of the thermo
+            //  table, ln(Kc) = -sum_s (nu''-nu') g0_s/(RT) - dn ln(RT/p0)
+            //  [(mol/cm^3)^dn], irreversible reactions get keq = 1; the values
+            //  are interpolated if a valid rate table is available
+            void keq(const scalar, scalarField&) const;
+
+            //- Calculate keq and d(ln keq)/dT of all reactions at once
+            void keq(const scalar, scalarField&, scalarField&) const;
+
+            //- Calculate ln(keq) and d(ln keq)/dT of all reactions at once
+            //  for temperature T and pressure p (Kc itself does not depend
+            //  on p)
+            void lnKeq
+            (
+                const scalar,
+                const scalar,
+                scalarField&,
+                scalarField&
+            ) const;
+
             //- Calculate k with standard arrhenius [units depend]
             scalar arrhenius
             (
@@ -115,6 +242,10 @@ class ChemistryCalc
                 const scalar
             ) const;
 
+            //- Calculate k with standard arrhenius for all reactions at
+            //  once (log form over the compiled SoA coefficients)
+            void arrhenius(const scalar, scalarField&) const;
+
             //- Lindemann approach
             scalar Lindemann
             (
@@ -123,13 +254,111 @@ class ChemistryCalc
                 const map<word, scalar>&
             ) const;
 
+            //- Lindemann approach for a given [M] [mol/cm^3]
+            scalar Lindemann(const int, const scalar, const scalar) const;
+
+            //- Calculate kf = kinf * Pr/(1+Pr) * F of fall off reaction r
+            //  for a given [M] (Lindemann, TROE or SRI broadening F) and
+            //  the derivatives d(kf)/dT and d(kf)/d[M]
+            scalar fallOff
+            (
+                const int,
+                const scalar,
+                const scalar,
+                scalar&,
+                scalar&
+            ) const;
+
+            //- Calculate kf of all fall off reactions at once (rows = fall
+            //  off reaction) for [M] and the high pressure limit kinf, the
+            //  reduced pressure Pr is returned as well. The rows of each
+            //  formulation are contiguous, hence k0, Pr, Fcent and F are
+            //  evaluated in branch free passes without per reaction switch
+            void fallOff
+            (
+                const scalar,
+                const scalarField&,
+                const scalarField&,
+                scalarField&,
+                scalarField&
+            ) const;
+
+            //- Calculate the broadening factor F of fall off row f for the
+            //  reduced pressure Pr and d(ln F)/d(ln Pr), d(ln F)/dT
+            scalar fallOffF
+            (
+                const int,
+                const scalar,
+                const scalar,
+                scalar&,
+                scalar&
+            ) const;
+
             //- Calculate Fcent for TROE formulation
             scalar Fcent(const int, const scalar) const;
 
-            //- Calculate Flog for TROE formulation
+            //- Calculate log10(F) for TROE formulation
             scalar Flog(const int, const scalar, const scalar) const;
 
+            //- Calculate the rate of progress of reaction r [mol/cm^3/s]
+            //  q = kf * prod(c^nu') - kb * prod(c^nu'') (times [M] for TBR)
+            scalar rateOfProgress
+            (
+                const int,
+                const scalar,
+                const map<word, scalar>&
+            ) const;
+
+            //- Calculate the rate of progress of reaction r [mol/cm^3/s]
+            //  for the concentration field c (ordered by species ID)
+            scalar rateOfProgress
+            (
+                const int,
+                const scalar,
+                const scalarField&
+            ) const;
+
+            //- Calculate the rate of progress of reaction r [mol/cm^3/s]
+            //  for already known rate constants kf and kb [units depend]
+            scalar rateOfProgress
+            (
+                const int,
+                const scalar,
+                const scalar,
+                const scalarField&
+            ) const;
+
+            //- Calculate the rate of progress of reaction r [mol/cm^3/s]
+            //  for already known kf, kb and [M] (only used for TBR)
+            scalar rateOfProgress
+            (
+                const int,
+                const scalar,
+                const scalar,
+                const scalar,
+                const scalarField&
+            ) const;
+
+            //- Calculate the rate of progress of all reactions [mol/cm^3/s]
+            void rateOfProgress
+            (
+                const scalar,
+                const map<word, scalar>&,
+                scalarField&
+            ) const;
+
+            //- Calculate the rate of progress of all reactions [mol/cm^3/s]
+            //  for the concentration field c (ordered by species ID)
+            void rateOfProgress
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&
+            ) const;
+
             //- Calculate the source term of species s (omega)
+            //  Note: evaluates all reactions of s, prefer the
+            //  whole-mechanism omega if more than one species is needed
             scalar omega
             (
 	            const word,
@@ -137,9 +366,163 @@ class ChemistryCalc
                 const map<word, scalar>&
             ) const;
 
+            //- Calculate the source term of all species (omega) at once
+            //  Each rate of progress is evaluated only once and scattered
+            //  to the species; the field is ordered as species()
+            void omega
+            (
+                const scalar,
+                const map<word, scalar>&,
+                scalarField&
+            ) const;
+
+            //- Calculate the source term of all species (omega) at once
+            //  for the concentration field c (ordered by species ID)
+            void omega
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&
+            ) const;
+
+            //- Calculate the source term of all species for N states at
+            //  once (e.g. a block of CFD cells) in SoA layout:
+            //  T[N] [K], p[N] [Pa], c[nSpecies][N] and omega[nSpecies][N]
+            //  The inner loops run over the states (contiguous memory)
+            void omega
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&
+            ) const;
+
+            //- Calculate the source term of all species for the states
+            //  [begin, end) of the SoA fields (omega is already sized)
+            //  Reentrant: only the given workspace is modified, hence
+            //  different threads can evaluate different blocks
+            void omega
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&,
+                const int,
+                const int,
+                ChemistryWorkspace&
+            ) const;
+
+            //- Calculate the source term of the states [begin, end) taking
+            //  only the active species and reactions of the state into
+            //  account (e.g. a locally reduced set, see
+            //  ChemistryReduction::activeSet); all other species are
+            //  frozen (omega = 0). The set is applied to all states of the
+            //  block [begin, end)
+            void omega
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&,
+                const int,
+                const int,
+                const List<int>&,
+                const List<int>&,
+                ChemistryWorkspace&
+            ) const;
+
+            //- Calculate the rate of progress of all reactions for the
+            //  states [begin, end) of the SoA fields, q[nReac][N] is
+            //  already sized. Reentrant as the SoA omega
+            void rateOfProgress
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&,
+                const int,
+                const int,
+                ChemistryWorkspace&
+            ) const;
+
+            //- Calculate the rate of progress of the given reactions for
+            //  the states [begin, end); g0/(RT) is only evaluated for the
+            //  given species, which have to include all species that are
+            //  converted by these reactions. Only the rows of q that
+            //  belong to the reactions are written
+            void rateOfProgress
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&,
+                const int,
+                const int,
+                const List<int>&,
+                const List<int>&,
+                ChemistryWorkspace&
+            ) const;
+
+            //- Calculate the derivatives of the rates of progress of all
+            //  reactions d(q_r)/d(c_j) and d(q_r)/dT (constant c)
+            //  d(q_r)/d(c_j) is stored in CSR format (rows = reactions),
+            //  a column j can occur more than once (values are summed)
+            void rateOfProgressDerivatives
+            (
+                const scalar,
+                const scalarField&,
+                List<int>&,
+                List<int>&,
+                scalarField&,
+                scalarField&
+            ) const;
+
+            //- Calculate the analytical Jacobian d(omega)/d(c) as dense
+            //  matrix (nSpecies x nSpecies) and d(omega)/dT for the
+            //  concentration field c (ordered by species ID)
+            void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                Matrix&,
+                scalarField&
+            ) const;
+
+            //- Calculate the analytical Jacobian d(omega)/d(c) in sparse
+            //  format (row s contains only the non-zero columns j) and
+            //  d(omega)/dT for the concentration field c
+            void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                mapList<int, scalar>&,
+                scalarField&
+            ) const;
+
+            //- Calculate the analytical Jacobian d(omega)/d(c) into the
+            //  fixed sparse structure of the mechanism (refill of the
+            //  values only) and d(omega)/dT. A matrix without structure
+            //  is initialized with mechanism().jacobianPattern()
+            void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                SparseMatrix&,
+                scalarField&
+            ) const;
+
             //- Calculate [M] partner [mol/m^3]
             scalar M(const int, const map<word, scalar>&) const;
 
+            //- Calculate [M] partner [mol/m^3] for the concentration field c
+            //  (ordered by species ID)
+            scalar M(const int, const scalarField&) const;
+
+            //- Calculate [M] of all third body reactions at once (rows =
+            //  third body reaction) out of the total concentration and the
+            //  sparse efficiency deltas
+            void M(const scalarField&, scalarField&) const;
+
             //- Calculate dH for reaction r and given temperature
             scalar dh(const int, const scalar) const;
 
@@ -35,6 +35,9 @@ TKC::ChemistryData::ChemistryData(const string fileName)
     ChemistryReader chemReader(fileName);
 
     chemReader.read(*this);
+
+    //- Build the index based mechanism once all data are available
+    mechanism_.compile(*this);
 }
 
 
@@ -188,6 +191,18 @@ void TKC::ChemistryData::SRICoeffs
 }
 
 
+void TKC::ChemistryData::PLOGCoeffs
+(
+    const scalar p,
+    const scalar A,
+    const scalar beta,
+    const scalar Ea
+)
+{
+    PLOGCoeffs_[nReac_].insert(PLOGCoeffs_[nReac_].end(), {p, A, beta, Ea});
+}
+
+
 void TKC::ChemistryData::ENHANCEDCoeffs
 (
     const word species,
@@ -265,6 +280,9 @@ void TKC::ChemistryData::incrementMatrixesVectors()
     //- boolList for THIRD BODY REACTION SRI
     SRI_.push_back(false);
 
+    //- boolList for PLOG reactions
+    PLOG_.push_back(false);
+
     //- boolList for THIRD BODY REACTION of ENHANCEMENT FACTORS
     ENHANCE_.push_back(false);
 
@@ -289,6 +307,9 @@ void TKC::ChemistryData::incrementMatrixesVectors()
     //- List of SRI coeffs
     SRICoeffs_.push_back(scalarField(5));
 
+    //- List of PLOG coeffs (grows with each pressure)
+    PLOGCoeffs_.push_back(scalarField());
+
     //- MapList of enhanced factors for adjustment (species + value)
     //  For each reaction we save it
     {
@@ -358,6 +379,12 @@ void TKC::ChemistryData::SRI(const bool set)
 }
 
 
+void TKC::ChemistryData::PLOG(const bool set)
+{
+    PLOG_[nReac_] = set;
+}
+
+
 void TKC::ChemistryData::ENHANCE(const bool set)
 {
     ENHANCE_[nReac_] = set;
@@ -492,6 +519,12 @@ bool TKC::ChemistryData::SRI(const int reacNo) const
 }
 
 
+bool TKC::ChemistryData::PLOG(const int reacNo) const
+{
+    return PLOG_[reacNo];
+}
+
+
 bool TKC::ChemistryData::ENHANCED(const int reacNo) const
 {
     return ENHANCE_[reacNo];
@@ -516,7 +549,7 @@ TKC::wordList TKC::ChemistryData::elements() const
 }
 
 
-TKC::wordList TKC::ChemistryData::species() const
+const TKC::wordList& TKC::ChemistryData::species() const
 {
     return species_;
 }
@@ -535,13 +568,15 @@ TKC::wordList TKC::ChemistryData::products(const int r) const
 }
 
 
-TKC::map<TKC::word, int> TKC::ChemistryData::nuEducts(const int r) const
+const TKC::map<TKC::word, int>&
+TKC::ChemistryData::nuEducts(const int r) const
 {
     return nuEducts_[r];
 }
 
 
-TKC::map<TKC::word, int> TKC::ChemistryData::nuProducts(const int r) const
+const TKC::map<TKC::word, int>&
+TKC::ChemistryData::nuProducts(const int r) const
 {
     return nuProducts_[r];
 }
@@ -619,7 +654,8 @@ bool TKC::ChemistryData::backwardReaction(const int r) const
 }
 
 
-TKC::scalarList TKC::ChemistryData::arrheniusCoeffs(const int reacNo) const
+const TKC::scalarList&
+TKC::ChemistryData::arrheniusCoeffs(const int reacNo) const
 {
     return arrheniusCoeffs_[reacNo];
 }
@@ -631,25 +667,33 @@ TKC::word TKC::ChemistryData::collisionPartner(const int reacNo) const
 }
 
 
-TKC::scalarList TKC::ChemistryData::LOWCoeffs(const int reacNo) const
+const TKC::scalarList& TKC::ChemistryData::LOWCoeffs(const int reacNo) const
 {
     return LOWCoeffs_[reacNo];
 }
 
 
-TKC::scalarList TKC::ChemistryData::TROECoeffs(const int reacNo) const
+const TKC::scalarList&
+TKC::ChemistryData::TROECoeffs(const int reacNo) const
 {
     return TROECoeffs_[reacNo];
 }
 
 
-TKC::scalarList TKC::ChemistryData::SRICoeffs(const int reacNo) const
+const TKC::scalarList& TKC::ChemistryData::SRICoeffs(const int reacNo) const
 {
     return SRICoeffs_[reacNo];
 }
 
 
-TKC::map<TKC::word, TKC::scalar>
+const TKC::scalarList&
+TKC::ChemistryData::PLOGCoeffs(const int reacNo) const
+{
+    return PLOGCoeffs_[reacNo];
+}
+
+
+const TKC::map<TKC::word, TKC::scalar>&
 TKC::ChemistryData::ENHANCEDCoeffs(const int reacNo) const
 {
     return ENHANCEDCoeffs_[reacNo];
@@ -722,4 +766,10 @@ TKC::scalar TKC::ChemistryData::globalReactionOrder(const int r) const
 }
 
 
+const TKC::ChemistryMechanism& TKC::ChemistryData::mechanism() const
+{
+    return mechanism_;
+}
+
+
 // ************************************************************************* //
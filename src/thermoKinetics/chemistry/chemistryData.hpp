@@ -37,6 +37,7 @@ SourceFiles
 
 #include "definitions.hpp"
 #include "thermo.hpp"
+#include "chemistryMechanism.hpp"
 #include "math.h"
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
@@ -141,6 +142,9 @@ class ChemistryData
             //- boolList for TBR SRI
             List<bool> SRI_;
 
+            //- boolList for pressure dependent reactions (PLOG)
+            List<bool> PLOG_;
+
             //- boolList for forward reaction only =>
             //  This list even contain the information of irreversible reac.
             List<bool> forwardReaction_;
@@ -161,6 +165,10 @@ class ChemistryData
             //- Matrix of SRI coeffs
             List<scalarField> SRICoeffs_;
 
+            //- Matrix of PLOG coeffs, four entries per pressure
+            //  (p [atm], A, beta, Ea [cal/mol]) in the order of the file
+            List<scalarField> PLOGCoeffs_;
+
             //- Enhanced coeffs for adjustment
             mapList<word, scalar> ENHANCEDCoeffs_;
 
@@ -171,6 +179,9 @@ class ChemistryData
             scalar dS_;
             scalar dG_;
 
+            //- Compiled (index based) mechanism, built after reading
+            ChemistryMechanism mechanism_;
+
 
         //- Thermodynamic available in chemistry file
         //bool thermo_;
@@ -238,6 +249,15 @@ class ChemistryData
             //- Insert SRI coeffs
             void SRICoeffs(const scalar, const unsigned int);
 
+            //- Insert PLOG coeffs of one pressure (p [atm], A, beta, Ea)
+            void PLOGCoeffs
+            (
+                const scalar,
+                const scalar,
+                const scalar,
+                const scalar
+            );
+
             //- Insert ENHANCE factors (species + value)
             void ENHANCEDCoeffs(const word, const scalar);
 
@@ -283,6 +303,9 @@ class ChemistryData
             //- Set the SRI boolean
             void SRI(const bool);
 
+            //- Set the PLOG boolean
+            void PLOG(const bool);
+
             //- Set the Enhance boolean
             void ENHANCE(const bool);
 
@@ -342,6 +365,9 @@ class ChemistryData
                 //- Return true if elementar reaction is a SRI reaction
                 bool SRI(const int) const;
 
+                //- Return true if elementar reaction is a PLOG reaction
+                bool PLOG(const int) const;
+
                 //- Return true if elementar reaction has enhanced factors
                 bool ENHANCED(const int) const;
 
@@ -359,7 +385,7 @@ class ChemistryData
             wordList elements() const;
 
             //- Return all species
-            wordList species() const;
+            const wordList& species() const;
 
             //- Return the educt species of reaction r
             wordList educts(const int) const;
@@ -398,10 +424,10 @@ class ChemistryData
             wordList speciesInReaction(const int) const;
 
             //- Return stochiometric factors of educts of reaction r
-            map<word, int> nuEducts(const int) const;
+            const map<word, int>& nuEducts(const int) const;
 
             //- Return stochiometric factors of educts of reaction r
-            map<word, int> nuProducts(const int) const;
+            const map<word, int>& nuProducts(const int) const;
 
             //- Return the exponent factor for Keq calculation
             scalar exponent(const int) const;
@@ -416,22 +442,25 @@ class ChemistryData
             //  [0] -> pre-exponent [units depend on equation]
             //  [1] -> temperature exponent [-]
             //  [2] -> activation energy [cal/mol]
-            scalarList arrheniusCoeffs(const int) const;
+            const scalarList& arrheniusCoeffs(const int) const;
 
             //- Return the collision number of reaction no.
             word collisionPartner(const int) const;
 
             //- Return arrhenius coeffs for high pressure for reaction no.
-            scalarList LOWCoeffs(const int) const;
+            const scalarList& LOWCoeffs(const int) const;
 
             //- Return TROE coeffs
-            scalarList TROECoeffs(const int) const;
+            const scalarList& TROECoeffs(const int) const;
 
             //- Return SRI coeffs
-            scalarList SRICoeffs(const int) const;
+            const scalarList& SRICoeffs(const int) const;
+
+            //- Return PLOG coeffs (p [atm], A, beta, Ea per pressure)
+            const scalarList& PLOGCoeffs(const int) const;
 
             //- Return ENHANCED factors (species + value) of reac no.
-            map<word, scalar> ENHANCEDCoeffs (const int) const;
+            const map<word, scalar>& ENHANCEDCoeffs(const int) const;
 
             //- Return reaction rate kf for reaction no.
             scalar kf(const int) const;
@@ -465,6 +494,9 @@ class ChemistryData
 
             //- Return global reaction order of reaction r
             scalar globalReactionOrder(const int) const;
+
+            //- Return the compiled (index based) mechanism
+            const ChemistryMechanism& mechanism() const;
 };
 
 
@@ -0,0 +1,358 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryDriver.hpp"
+#include <algorithm>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryDriver::ChemistryDriver
+(
+    const ChemistryCalc& chemistry,
+    const int nThreads,
+    const int blockSize
+)
+:
+    chemistry_(chemistry),
+    pool_(nThreads),
+    workspaces_(pool_.nThreads()),
+    blockSize_(max(blockSize, 1))
+{
+    buildBlocks();
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryDriver::~ChemistryDriver()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryDriver::omega
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    List<scalarField>& omega
+)
+{
+    const int N = T.size();
+
+    //- Sized once, the tasks only write into their own block
+    omega.resize(chemistry_.mechanism().nSpecies());
+
+    forAll(omega, w)
+    {
+        w.resize(N);
+    }
+
+    run
+    (
+        N,
+        [&](ChemistryWorkspace& ws, const int begin, const int end)
+        {
+            chemistry_.omega(T, p, c, omega, begin, end, ws);
+        }
+    );
+}
+
+
+void TKC::ChemistryDriver::activeSets
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    const ChemistryReduction& reduction,
+    List<List<int>>& species,
+    List<List<int>>& reactions
+)
+{
+    const int N = T.size();
+    const int nR = chemistry_.mechanism().nReac();
+
+    //- Rates of progress of all states, each task writes its block
+    List<scalarField> q(nR, scalarField(N));
+
+    species.resize(N);
+    reactions.resize(N);
+
+    run
+    (
+        N,
+        [&](ChemistryWorkspace& ws, const int begin, const int end)
+        {
+            chemistry_.rateOfProgress(T, p, c, q, begin, end, ws);
+
+            scalarField qn(nR);
+
+            for (int n = begin; n < end; ++n)
+            {
+                for (int r = 0; r < nR; ++r)
+                {
+                    qn[r] = q[r][n];
+                }
+
+                reduction.activeSet(qn, species[n], reactions[n]);
+            }
+        }
+    );
+}
+
+
+void TKC::ChemistryDriver::omega
+(
+    const scalarField& T,
+    const scalarField& p,
+    const List<scalarField>& c,
+    const List<List<int>>& species,
+    const List<List<int>>& reactions,
+    List<scalarField>& omega
+)
+{
+    const int N = T.size();
+
+    omega.resize(chemistry_.mechanism().nSpecies());
+
+    forAll(omega, w)
+    {
+        w.resize(N);
+    }
+
+    //- The active sets differ from state to state, neighbouring states
+    //  with the same set (e.g. cold mixture) are evaluated as one block
+    run
+    (
+        N,
+        [&](ChemistryWorkspace& ws, const int begin, const int end)
+        {
+            int n = begin;
+
+            while (n < end)
+            {
+                int m = n + 1;
+
+                while
+                (
+                    m < end
+                 && reactions[m] == reactions[n]
+                 && species[m] == species[n]
+                )
+                {
+                    ++m;
+                }
+
+                chemistry_.omega
+                (
+                    T, p, c, omega, n, m, species[n], reactions[n], ws
+                );
+
+                n = m;
+            }
+        }
+    );
+}
+
+
+void TKC::ChemistryDriver::omega
+(
+    const scalar T,
+    const scalar p,
+    const scalarField& c,
+    scalarField& omega
+)
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int nS = mech.nSpecies();
+
+    T1_[0] = T;
+    p1_[0] = p;
+
+    for (int s = 0; s < nS; ++s)
+    {
+        c1_[s][0] = c[s];
+    }
+
+    omega.resize(nS);
+
+    //- Phase 1: rates of progress of the reaction blocks
+    pool_.run
+    (
+        reactionBlocks_.size(),
+        [&](const int worker, const int b)
+        {
+            chemistry_.rateOfProgress
+            (
+                T1_, p1_, c1_, q1_, 0, 1,
+                reactionBlockSpecies_[b], reactionBlocks_[b],
+                workspaces_[worker]
+            );
+        }
+    );
+
+    //- Phase 2: gather the source terms of the species blocks, the
+    //  reactions are summed in the same order as the scatter of the
+    //  sequential kernel
+    const List<int>& start = mech.speciesReacStart();
+    const List<int>& id = mech.speciesReacID();
+    const List<int>& nu = mech.speciesReacNu();
+
+    pool_.run
+    (
+        speciesBlockStart_.size() - 1,
+        [&](const int, const int b)
+        {
+            const int first = speciesBlockStart_[b];
+            const int last = speciesBlockStart_[b+1];
+
+            for (int s = first; s < last; ++s)
+            {
+                scalar w{0};
+
+                for (int i = start[s]; i < start[s+1]; ++i)
+                {
+                    if (nu[i] != 0)
+                    {
+                        w += nu[i] * q1_[id[i]][0];
+                    }
+                }
+
+                omega[s] = w;
+            }
+        }
+    );
+}
+
+
+void TKC::ChemistryDriver::run
+(
+    const int N,
+    const std::function<void(ChemistryWorkspace&, const int, const int)>& func
+)
+{
+    const int nTasks = (N + blockSize_ - 1) / blockSize_;
+
+    pool_.run
+    (
+        nTasks,
+        [&](const int worker, const int task)
+        {
+            const int begin = task * blockSize_;
+            const int end = min(begin + blockSize_, N);
+
+            func(workspaces_[worker], begin, end);
+        }
+    );
+}
+
+
+void TKC::ChemistryDriver::buildBlocks()
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int nS = mech.nSpecies();
+    const int nR = mech.nReac();
+
+    //- Some more blocks than threads to let the pool balance them
+    const int nBlocks = 4*pool_.nThreads();
+
+    //- Reaction blocks of equal size
+    const int nRB = max(min(nBlocks, nR), 1);
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+
+    reactionBlocks_.assign(nRB, List<int>());
+    reactionBlockSpecies_.assign(nRB, List<int>());
+
+    for (int b = 0; b < nRB; ++b)
+    {
+        List<int>& reactions = reactionBlocks_[b];
+        List<int>& species = reactionBlockSpecies_[b];
+
+        for (int r = b*nR/nRB; r < (b+1)*nR/nRB; ++r)
+        {
+            reactions.push_back(r);
+
+            for (int i = netStart[r]; i < netStart[r+1]; ++i)
+            {
+                species.push_back(netID[i]);
+            }
+        }
+
+        std::sort(species.begin(), species.end());
+
+        species.erase
+        (
+            std::unique(species.begin(), species.end()),
+            species.end()
+        );
+    }
+
+    //- Species blocks with about the same number of incidence entries
+    const List<int>& start = mech.speciesReacStart();
+
+    const int nnz = start[nS];
+    const int nSB = max(min(nBlocks, nS), 1);
+
+    speciesBlockStart_.assign(1, 0);
+
+    for (int s = 0; s < nS; ++s)
+    {
+        const int b = speciesBlockStart_.size();
+
+        if (start[s+1] >= b*nnz/nSB && s+1 < nS)
+        {
+            speciesBlockStart_.push_back(s+1);
+        }
+    }
+
+    speciesBlockStart_.push_back(nS);
+
+    //- Single state buffers
+    T1_.assign(1, 0);
+    p1_.assign(1, 0);
+    c1_.assign(nS, scalarField(1, 0));
+    q1_.assign(nR, scalarField(1, 0));
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::ChemistryDriver::nThreads() const
+{
+    return pool_.nThreads();
+}
+
+
+int TKC::ChemistryDriver::blockSize() const
+{
+    return blockSize_;
+}
+
+
+// ************************************************************************* //
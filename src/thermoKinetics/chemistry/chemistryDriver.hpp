@@ -0,0 +1,208 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryDriver
+
+Description
+    Thread parallel driver around the batched chemistry entry points. A
+    block of N states (e.g. CFD cells) is split into tasks of blockSize
+    states that are processed by a WorkStealingPool. Each worker owns its
+    ChemistryWorkspace; the chemistry object itself is only read.
+
+    Note: only the reentrant, workspace based functions of ChemistryCalc
+    may be used inside the tasks (no update functions of ChemistryData).
+
+    Dynamic adaptive chemistry: activeSets() reduces the mechanism for
+    each state (DRG/DRGEP sweep of a ChemistryReduction) and the omega
+    overload with the active sets evaluates only the active reactions of
+    each state, all other species are frozen. The sets are meant to be
+    updated once per (CFD) time step and reused for all source term
+    evaluations of the integration.
+
+    Reaction parallel evaluation: for very large mechanisms even a single
+    state is worth to be split. The omega overload of a single state works
+    in two phases: (1) the rates of progress of disjoint reaction blocks
+    and (2) the source terms of disjoint species blocks, gathered through
+    the transposed stochiometry (species to reaction incidence). Hence,
+    each thread writes only its own entries (no atomics). The blocks are
+    built once in the constructor and balanced by the number of entries.
+
+SourceFiles
+    chemistryDriver.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryDriver_hpp
+#define ChemistryDriver_hpp
+
+#include "chemistryCalc.hpp"
+#include "chemistryReduction.hpp"
+#include "chemistryWorkspace.hpp"
+#include "workStealingPool.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                        Class ChemistryDriver Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryDriver
+{
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Thread pool
+            WorkStealingPool pool_;
+
+            //- Workspace of each worker
+            List<ChemistryWorkspace> workspaces_;
+
+            //- Number of states per task
+            int blockSize_;
+
+
+        // Reaction parallel evaluation of a single state
+
+            //- Reactions of each block (phase 1)
+            List<List<int>> reactionBlocks_;
+
+            //- Converted species of each reaction block (g0/(RT) needed)
+            List<List<int>> reactionBlockSpecies_;
+
+            //- Species blocks [start[b], start[b+1]) (phase 2)
+            List<int> speciesBlockStart_;
+
+            //- Single state in SoA layout and its rates of progress
+            scalarField T1_;
+            scalarField p1_;
+            List<scalarField> c1_;
+            List<scalarField> q1_;
+
+
+        // Private Member Functions
+
+            //- Build the reaction and species blocks
+            void buildBlocks();
+
+
+    public:
+
+        //- Constructor, nThreads = 0 uses all hardware threads
+        ChemistryDriver
+        (
+            const ChemistryCalc&,
+            const int nThreads = 0,
+            const int blockSize = 64
+        );
+
+        //- Destructor
+        ~ChemistryDriver();
+
+
+        // Member Functions
+
+            //- Calculate the source term of all species for N states in
+            //  SoA layout (see ChemistryCalc::omega) in parallel
+            void omega
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                List<scalarField>&
+            );
+
+            //- Calculate the locally active species and reactions of each
+            //  of the N states in SoA layout in parallel
+            void activeSets
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                const ChemistryReduction&,
+                List<List<int>>&,
+                List<List<int>>&
+            );
+
+            //- Calculate the source term of all species for N states in
+            //  SoA layout in parallel, evaluating only the active species
+            //  and reactions of each state (see activeSets)
+            void omega
+            (
+                const scalarField&,
+                const scalarField&,
+                const List<scalarField>&,
+                const List<List<int>>&,
+                const List<List<int>>&,
+                List<scalarField>&
+            );
+
+            //- Calculate the source term of all species of a single state
+            //  [mol/cm^3/s] with the reactions and species distributed
+            //  over the threads (see Description), c in [mol/cm^3]
+            void omega
+            (
+                const scalar,
+                const scalar,
+                const scalarField&,
+                scalarField&
+            );
+
+            //- Execute func(workspace, begin, end) for all blocks of the N
+            //  states in parallel (e.g. the integration of each cell)
+            void run
+            (
+                const int,
+                const std::function
+                <
+                    void(ChemistryWorkspace&, const int, const int)
+                >&
+            );
+
+
+        // Return Functions
+
+            //- Return the number of threads
+            int nThreads() const;
+
+            //- Return the number of states per task
+            int blockSize() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryDriver_hpp included
+
+// ************************************************************************* //
@@ -0,0 +1,92 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Namespace
+    TKC::ChemistryGenerated
+
+Description
+    Interface of the mechanism specific kinetics that are written by the
+    ChemistryGenerator (application mechanismCodeGenerator). The generated
+    translation unit implements these functions with hard coded
+    coefficients; copy it into src/ and rebuild to link it into the
+    library as alternative to the index based ChemistryCalc functions.
+
+    All fields are ordered as the species (reactions) of the mechanism and
+    use the same units as ChemistryCalc (c in [mol/cm^3], p in [Pa]).
+
+SourceFiles
+    generated by ChemistryGenerator
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryGenerated_hpp
+#define ChemistryGenerated_hpp
+
+#include "definitions.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+namespace ChemistryGenerated
+{
+
+    //- Return the number of species
+    int nSpecies();
+
+    //- Return the number of reactions
+    int nReac();
+
+    //- Return the name of species s
+    word species(const int);
+
+    //- Calculate kf of all reactions for T, p (PLOG) and c (fall off)
+    void kf(const scalar, const scalar, const scalarField&, scalarField&);
+
+    //- Calculate keq of all reactions for T and p
+    void keq(const scalar, const scalar, scalarField&);
+
+    //- Calculate the source term of all species for T, p and c
+    void omega(const scalar, const scalar, const scalarField&, scalarField&);
+
+    //- Calculate d(omega)/d(c) for T, p and c (dense, row major)
+    void jacobian
+    (
+        const scalar,
+        const scalar,
+        const scalarField&,
+        scalarField&
+    );
+
+} // End namespace ChemistryGenerated
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryGenerated_hpp included
+
+// ************************************************************************* //
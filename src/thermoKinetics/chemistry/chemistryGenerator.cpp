@@ -0,0 +1,859 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryGenerator.hpp"
+#include "constants.hpp"
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <math.h>
+#include <sstream>
+#include <type_traits>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryGenerator::ChemistryGenerator
+(
+    const ChemistryCalc& chemistry,
+    const Thermo& thermo
+)
+:
+    chemistry_(chemistry),
+    thermo_(thermo)
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryGenerator::~ChemistryGenerator()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryGenerator::write(const string fileName) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int nS = mech.nSpecies();
+    const int nR = mech.nReac();
+
+    const wordList& species = chemistry_.species();
+
+    const bool plog = !mech.plogReac().empty();
+
+    Info<< " c-o Write the mechanism specific code\n"
+        << "     >> " << fileName << "\n" << endl;
+
+    std::filebuf file;
+
+    if (!file.open(fileName, std::ios::out))
+    {
+        ErrorMsg
+        (
+            "    Could not open the file " + fileName,
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    ostream os(&file);
+
+    //- Header
+    os  << "/*------------------------------------------------------------"
+        << "---------------*\\\n"
+        << "    Mechanism specific kinetics, generated by "
+        << "TKC::ChemistryGenerator\n"
+        << "    Species: " << nS << ", reactions: " << nR << "\n";
+
+    if (plog)
+    {
+        os  << "    PLOG reactions are interpolated in ln(p) for the pressure "
+            << "argument\n";
+    }
+
+    os  << "\n"
+        << "    Do not edit, re-generate it if the mechanism changes\n"
+        << "\\*-----------------------------------------------------------"
+        << "----------------*/\n\n"
+        << "#include \"chemistryGenerated.hpp\"\n"
+        << "#include <limits>\n"
+        << "#include <math.h>\n\n"
+        << "// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *"
+        << " * * * * * * //\n\n"
+        << "namespace TKC\n{\n\nnamespace ChemistryGenerated\n{\n\n"
+        << "//- Number of species and reactions\n"
+        << "static const int nS = " << nS << ";\n"
+        << "static const int nR = " << nR << ";\n\n"
+        << "//- Species names\n"
+        << "static const char* const speciesNames[" << nS << "] =\n{\n";
+
+    forEach(species, s)
+    {
+        os  << "    \"" << species[s] << "\"" << (s+1 < species.size() ? ",":"")
+            << "\n";
+    }
+
+    os  << "};\n\n\n";
+
+    writeGibbs(os);
+    writeFallOff(os);
+
+    if (plog)
+    {
+        writePLOG(os);
+    }
+
+    //- Interface
+    os  << "int nSpecies()\n{\n    return nS;\n}\n\n\n"
+        << "int nReac()\n{\n    return nR;\n}\n\n\n"
+        << "word species(const int s)\n{\n    return speciesNames[s];\n}\n\n\n";
+
+    //- Common terms of the functions
+    const string preamble =
+        "    const scalar lnT = log(T);\n"
+        "    const scalar rT = 1/T;\n"
+      + string(plog ? "    const scalar lnP = log(p);\n" : "");
+
+    const string thermo =
+        "    scalar g[nS];\n"
+        "    gibbs(T, g);\n\n"
+        "    const scalar lnP0RT = -log("
+      + num(Constants::RcmPa/Constants::p0) + "*T);\n";
+
+    //- kf
+    os  << "void kf\n(\n    const scalar T,\n    const scalar p,\n"
+        << "    const scalarField& c,\n    scalarField& k\n)\n"
+        << "{\n" << preamble << "\n    k.resize(nR);\n";
+
+    for (int r = 0; r < nR; ++r)
+    {
+        os  << "\n    //- " << chemistry_.elementarReaction(r) << "\n    {\n";
+        writeKf(os, r);
+        os  << "        k[" << r << "] = kf;\n    }\n";
+    }
+
+    os  << "}\n\n\n";
+
+    //- keq
+    os  << "void keq(const scalar T, const scalar p, scalarField& K)\n"
+        << "{\n" << thermo << "\n    K.assign(nR, 1);\n";
+
+    for (int r = 0; r < nR; ++r)
+    {
+        if (mech.backward(r))
+        {
+            os  << "\n    //- " << chemistry_.elementarReaction(r) << "\n    {\n";
+            writeKc(os, r);
+            os  << "        K[" << r << "] = Kc;\n    }\n";
+        }
+    }
+
+    os  << "}\n\n\n";
+
+    //- omega and Jacobian share the code of each reaction
+    for (int f = 0; f < 2; ++f)
+    {
+        const bool jac = (f == 1);
+
+        if (jac)
+        {
+            os  << "void jacobian\n(\n    const scalar T,\n"
+                << "    const scalar p,\n    const scalarField& c,\n"
+                << "    scalarField& J\n)\n{\n"
+                << preamble << thermo << "\n    J.assign(nS*nS, 0);\n";
+        }
+        else
+        {
+            os  << "void omega\n(\n    const scalar T,\n"
+                << "    const scalar p,\n    const scalarField& c,\n"
+                << "    scalarField& omega\n)\n{\n"
+                << preamble << thermo << "\n    omega.assign(nS, 0);\n";
+        }
+
+        const List<int>& rStart = mech.reactantStart();
+        const List<int>& rID = mech.reactantID();
+        const List<int>& rNu = mech.reactantNu();
+        const List<int>& pStart = mech.productStart();
+        const List<int>& pID = mech.productID();
+        const List<int>& pNu = mech.productNu();
+        const List<int>& netStart = mech.netStart();
+        const List<int>& netID = mech.netID();
+        const List<int>& netNu = mech.netNu();
+
+        for (int r = 0; r < nR; ++r)
+        {
+            os  << "\n    //- " << chemistry_.elementarReaction(r) << "\n    {\n";
+
+            writeKf(os, r);
+
+            if (mech.backward(r))
+            {
+                writeKc(os, r);
+                os  << "        const scalar kr = kf/Kc;\n";
+            }
+
+            const bool thirdBody = mech.type(r) == ChemistryMechanism::thirdBody;
+
+            if (thirdBody)
+            {
+                writeM(os, r);
+            }
+
+            //- The Jacobian needs the rates only for d(q)/d[M]
+            if (!jac || thirdBody)
+            {
+                os  << "        const scalar fwd = "
+                    << (
+                           mech.forward(r)
+                         ? "kf*" + product(rStart, rID, rNu, r)
+                         : string("0")
+                       )
+                    << ";\n"
+                    << "        const scalar rev = "
+                    << (
+                           mech.backward(r)
+                         ? "kr*" + product(pStart, pID, pNu, r)
+                         : string("0")
+                       )
+                    << ";\n";
+            }
+
+            if (jac)
+            {
+                writeJacobian(os, r);
+            }
+            else
+            {
+                os  << "        const scalar q = "
+                    << (thirdBody ? "(fwd - rev)*M" : "fwd - rev") << ";\n\n";
+
+                for (int i = netStart[r]; i < netStart[r+1]; ++i)
+                {
+                    os  << "        omega[" << netID[i] << "] ";
+
+                    if (netNu[i] == 1)
+                    {
+                        os  << "+= q;\n";
+                    }
+                    else if (netNu[i] == -1)
+                    {
+                        os  << "-= q;\n";
+                    }
+                    else
+                    {
+                        os  << "+= " << netNu[i] << "*q;\n";
+                    }
+                }
+            }
+
+            os  << "    }\n";
+        }
+
+        os  << "}\n\n\n";
+    }
+
+    os  << "// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *"
+        << " * * * * * * //\n\n"
+        << "} // End namespace ChemistryGenerated\n\n"
+        << "} // End namespace TKC\n\n"
+        << "// ***************************************************************"
+        << "********** //\n";
+
+    file.close();
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+TKC::string TKC::ChemistryGenerator::num(const scalar value) const
+{
+    std::ostringstream os;
+
+    //- Scientific notation is always a floating point literal
+    os  << std::scientific
+        << std::setprecision(std::numeric_limits<scalar>::max_digits10 - 1)
+        << value;
+
+    //- Keep the precision of long double literals
+    if (std::is_same<scalar, long double>::value)
+    {
+        os  << "L";
+    }
+
+    return os.str();
+}
+
+
+TKC::string TKC::ChemistryGenerator::linear
+(
+    const scalarField& a,
+    const wordList& x
+) const
+{
+    string expr;
+
+    forEach(a, i)
+    {
+        if (a[i] == 0)
+        {
+            continue;
+        }
+
+        //- Sign
+        if (expr.empty())
+        {
+            expr += (a[i] < 0 ? "-" : "");
+        }
+        else
+        {
+            expr += (a[i] < 0 ? " - " : " + ");
+        }
+
+        const scalar value = fabs(a[i]);
+
+        if (x[i].empty())
+        {
+            expr += num(value);
+        }
+        else if (value == 1)
+        {
+            expr += x[i];
+        }
+        else
+        {
+            expr += num(value) + "*" + x[i];
+        }
+    }
+
+    return (expr.empty() ? string("0") : expr);
+}
+
+
+TKC::string TKC::ChemistryGenerator::arrhenius
+(
+    const scalar A,
+    const scalar beta,
+    const scalar Ea
+) const
+{
+    if (A == 0)
+    {
+        return "0";
+    }
+
+    //- Constant rate
+    if (beta == 0 && Ea == 0)
+    {
+        return num(A);
+    }
+
+    //- Log form k = A exp(beta lnT - Ta/T)
+    const string expr =
+        "exp("
+      + linear
+        (
+            scalarField{log(fabs(A)), beta, -Ea/Constants::Rcal},
+            wordList{"", "lnT", "rT"}
+        )
+      + ")";
+
+    return (A < 0 ? "-" + expr : expr);
+}
+
+
+TKC::string TKC::ChemistryGenerator::product
+(
+    const List<int>& start,
+    const List<int>& id,
+    const List<int>& nu,
+    const int r,
+    const int skip
+) const
+{
+    string expr;
+
+    for (int i = start[r]; i < start[r+1]; ++i)
+    {
+        int exponent = nu[i];
+
+        //- Derivative with respect to entry skip: nu c^(nu-1)
+        if (i == skip)
+        {
+            if (nu[i] > 1)
+            {
+                expr += (expr.empty() ? "" : "*") + toStr(nu[i]);
+            }
+
+            exponent -= 1;
+        }
+
+        //- Integer powers are expanded
+        for (int e = 0; e < exponent; ++e)
+        {
+            expr += (expr.empty() ? "" : "*") + string("c[")
+                  + toStr(id[i]) + "]";
+        }
+    }
+
+    return (expr.empty() ? string("1") : expr);
+}
+
+
+void TKC::ChemistryGenerator::writeKf(ostream& os, const int r) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    string kinf = arrhenius(mech.A()[r], mech.beta()[r], mech.Ea()[r]);
+
+    //- PLOG reaction, the pressure points as constants
+    const int pl = mech.plogIndex()[r];
+
+    if (pl != -1)
+    {
+        const int first = mech.plogStart()[pl];
+        const int n = mech.plogStart()[pl+1] - first;
+
+        const auto points = [&](const string name, const scalarField& field)
+        {
+            os  << "        static const scalar " << name << "[" << n
+                << "] = {";
+
+            for (int i = 0; i < n; ++i)
+            {
+                os  << (i == 0 ? "" : ", ") << num(field[first+i]);
+            }
+
+            os  << "};\n";
+        };
+
+        points("plogLnP", mech.plogLnP());
+        points("plogLnA", mech.plogLnA());
+        points("plogBeta", mech.plogBeta());
+        points("plogTa", mech.plogTa());
+
+        kinf =
+            "plog(lnP, lnT, rT, " + toStr(n)
+          + ", plogLnP, plogLnA, plogBeta, plogTa)";
+    }
+
+    if (mech.type(r) != ChemistryMechanism::fallOff)
+    {
+        os  << "        const scalar kf = " << kinf << ";\n";
+        return;
+    }
+
+    writeM(os, r);
+
+    //- Fall off reaction
+    const int f = mech.fallOffIndex()[r];
+
+    os  << "        const scalar kinf = " << kinf << ";\n"
+        << "        const scalar k0 = "
+        << arrhenius(mech.lowA()[f], mech.lowBeta()[f], mech.lowEa()[f])
+        << ";\n"
+        << "        scalar dkfdM{0};\n"
+        << "        const scalar kf = ";
+
+    switch (mech.fallOffType()[f])
+    {
+        case ChemistryMechanism::TROE:
+        {
+            os  << "troe(kinf, k0, M, T, "
+                << num(mech.troeAlpha()[f]) << ", "
+                << num(mech.troeT3()[f]) << ", "
+                << num(mech.troeT1()[f]) << ", "
+                << num(mech.troeT2()[f]) << ", dkfdM);\n";
+            break;
+        }
+
+        case ChemistryMechanism::SRI:
+        {
+            os  << "sri(kinf, k0, M, T, "
+                << num(mech.sriA()[f]) << ", "
+                << num(mech.sriB()[f]) << ", "
+                << num(mech.sriC()[f]) << ", "
+                << num(mech.sriD()[f]) << ", "
+                << num(mech.sriE()[f]) << ", dkfdM);\n";
+            break;
+        }
+
+        default:
+        {
+            os  << "fallOff(kinf, k0, M, 1, 0, dkfdM);\n";
+        }
+    }
+}
+
+
+void TKC::ChemistryGenerator::writeM(ostream& os, const int r) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int tb = mech.thirdBodyIndex()[r];
+    const List<int>& start = mech.efficiencyStart();
+
+    scalarField a;
+    wordList x;
+
+    for (int i = start[tb]; i < start[tb+1]; ++i)
+    {
+        a.push_back(mech.efficiency()[i]);
+        x.push_back("c[" + toStr(mech.efficiencyID()[i]) + "]");
+    }
+
+    os  << "        const scalar M = " << linear(a, x) << ";\n";
+}
+
+
+void TKC::ChemistryGenerator::writeKc(ostream& os, const int r) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    //- ln(Kc) = -sum_s nu_s g0_s/(RT) + dn*ln(p0/(RT))
+    scalarField a;
+    wordList x;
+
+    for (int i = mech.netStart()[r]; i < mech.netStart()[r+1]; ++i)
+    {
+        a.push_back(-mech.netNu()[i]);
+        x.push_back("g[" + toStr(mech.netID()[i]) + "]");
+    }
+
+    a.push_back(mech.dn()[r]);
+    x.push_back("lnP0RT");
+
+    os  << "        const scalar Kc = exp(" << linear(a, x) << ");\n";
+}
+
+
+void TKC::ChemistryGenerator::writeGibbs(ostream& os) const
+{
+    const wordList& species = chemistry_.species();
+
+    os  << "//- g0/(RT) of all species\n"
+        << "static inline void gibbs(const scalar T, scalar* g)\n{\n"
+        << "    const scalar T2 = T*T;\n"
+        << "    const scalar T3 = T2*T;\n"
+        << "    const scalar T4 = T3*T;\n"
+        << "    const scalar lnT = log(T);\n"
+        << "    const scalar rT = 1/T;\n";
+
+    const wordList x{"", "lnT", "T", "T2", "T3", "T4", "rT"};
+
+    forEach(species, s)
+    {
+        const word& name = species[s];
+
+        //- g0/(RT) = a0 (1 - lnT) - a1/2 T - a2/6 T^2 - a3/12 T^3
+        //          - a4/20 T^4 + a5/T - a6
+        const auto coeffs = [&](const List<scalar>& a)
+        {
+            return
+                linear
+                (
+                    scalarField
+                    {
+                        a[0] - a[6], -a[0], -a[1]/2, -a[2]/6, -a[3]/12,
+                        -a[4]/20, a[5]
+                    },
+                    x
+                );
+        };
+
+        //- Same range selection as ThermoCalc::whichTempRange
+        os  << "\n    //- " << name << "\n"
+            << "    if ((T > " << num(thermo_.HT(name)) << ") || (T >= "
+            << num(thermo_.LT(name)) << " && T > "
+            << num(thermo_.CT(name)) << "))\n    {\n"
+            << "        g[" << s << "] = "
+            << coeffs(thermo_.NASACoeffsHT(name)) << ";\n    }\n"
+            << "    else\n    {\n"
+            << "        g[" << s << "] = "
+            << coeffs(thermo_.NASACoeffsLT(name)) << ";\n    }\n";
+    }
+
+    os  << "}\n\n\n";
+}
+
+
+void TKC::ChemistryGenerator::writeFallOff(ostream& os) const
+{
+    os  <<
+R"(//- Fall off kf = kinf*Pr/(1+Pr)*F and d(kf)/d[M] for the broadening F
+static inline scalar fallOff
+(
+    const scalar kinf,
+    const scalar k0,
+    const scalar M,
+    const scalar F,
+    const scalar dlnFdlnPr,
+    scalar& dkfdM
+)
+{
+    const scalar Pr = k0*M/kinf;
+
+    dkfdM = F/(1 + Pr)*(1/(1 + Pr) + dlnFdlnPr)*k0;
+
+    return kinf*Pr/(1 + Pr)*F;
+}
+
+
+//- TROE broadening
+static inline scalar troe
+(
+    const scalar kinf,
+    const scalar k0,
+    const scalar M,
+    const scalar T,
+    const scalar alpha,
+    const scalar T3,
+    const scalar T1,
+    const scalar T2,
+    scalar& dkfdM
+)
+{
+    const scalar small = std::numeric_limits<scalar>::min();
+
+    const scalar Pr = k0*M/kinf;
+    const scalar logPr = log10(Pr > small ? Pr : small);
+
+    scalar Fcent = (1 - alpha)*exp(-T/T3) + alpha*exp(-T/T1);
+
+    if (T2 != 0)
+    {
+        Fcent += exp(-T2/T);
+    }
+
+    const scalar L = log10(Fcent > small ? Fcent : small);
+    const scalar C = -0.4 - 0.67*L;
+    const scalar N = 0.75 - 1.27*L;
+    const scalar x = logPr + C;
+    const scalar D = N - 0.14*x;
+    const scalar f1 = x/D;
+    const scalar g = 1/(1 + f1*f1);
+
+    return fallOff(kinf, k0, M, pow(10, L*g), -2*L*f1*g*g*N/(D*D), dkfdM);
+}
+
+
+//- SRI broadening
+static inline scalar sri
+(
+    const scalar kinf,
+    const scalar k0,
+    const scalar M,
+    const scalar T,
+    const scalar a,
+    const scalar b,
+    const scalar c,
+    const scalar d,
+    const scalar e,
+    scalar& dkfdM
+)
+{
+    const scalar small = std::numeric_limits<scalar>::min();
+
+    const scalar Pr = k0*M/kinf;
+    const scalar logPr = log10(Pr > small ? Pr : small);
+
+    const scalar X = 1/(1 + logPr*logPr);
+    const scalar base = a*exp(-b/T) + exp(-T/c);
+
+    return
+        fallOff
+        (
+            kinf,
+            k0,
+            M,
+            d*pow(base, X)*pow(T, e),
+            -2*log(base)*logPr*X*X/log(scalar(10)),
+            dkfdM
+        );
+}
+
+
+)";
+}
+
+
+void TKC::ChemistryGenerator::writePLOG(ostream& os) const
+{
+    os  <<
+R"(//- PLOG, ln(k) linear in ln(p) between the n pressure points; outside of
+//  the given pressures the first or last pressure is used
+static inline scalar plog
+(
+    const scalar lnP,
+    const scalar lnT,
+    const scalar rT,
+    const int n,
+    const scalar* lnPp,
+    const scalar* lnA,
+    const scalar* beta,
+    const scalar* Ta
+)
+{
+    if (lnP <= lnPp[0] || lnP >= lnPp[n-1])
+    {
+        const int j = lnP <= lnPp[0] ? 0 : n-1;
+
+        return exp(lnA[j] + beta[j]*lnT - Ta[j]*rT);
+    }
+
+    //- Bracket lnP_j < lnP <= lnP_j+1
+    int j = 0;
+
+    while (lnP > lnPp[j+1])
+    {
+        ++j;
+    }
+
+    const scalar w = (lnP - lnPp[j])/(lnPp[j+1] - lnPp[j]);
+
+    return
+        exp
+        (
+            lnA[j] + w*(lnA[j+1] - lnA[j])
+          + (beta[j] + w*(beta[j+1] - beta[j]))*lnT
+          - (Ta[j] + w*(Ta[j+1] - Ta[j]))*rT
+        );
+}
+
+
+)";
+}
+
+
+void TKC::ChemistryGenerator::writeJacobian(ostream& os, const int r) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const List<int>& rStart = mech.reactantStart();
+    const List<int>& rID = mech.reactantID();
+    const List<int>& rNu = mech.reactantNu();
+    const List<int>& pStart = mech.productStart();
+    const List<int>& pID = mech.productID();
+    const List<int>& pNu = mech.productNu();
+
+    const bool thirdBody = mech.type(r) == ChemistryMechanism::thirdBody;
+    const bool fallOff = mech.type(r) == ChemistryMechanism::fallOff;
+
+    //- d(q)/d(c_j) as (j, expression)
+    List<int> cols;
+    wordList exprs;
+
+    const string factor = thirdBody ? "M*" : "";
+
+    if (mech.forward(r))
+    {
+        for (int i = rStart[r]; i < rStart[r+1]; ++i)
+        {
+            cols.push_back(rID[i]);
+            exprs.push_back
+            (
+                factor + "kf*" + product(rStart, rID, rNu, r, i)
+            );
+        }
+    }
+
+    if (mech.backward(r))
+    {
+        for (int i = pStart[r]; i < pStart[r+1]; ++i)
+        {
+            cols.push_back(pID[i]);
+            exprs.push_back
+            (
+                "-" + factor + "kr*" + product(pStart, pID, pNu, r, i)
+            );
+        }
+    }
+
+    //- Third body and fall off: d(q)/d[M] times the efficiency
+    const int tb = mech.thirdBodyIndex()[r];
+
+    if (tb != -1)
+    {
+        if (thirdBody)
+        {
+            os  << "        const scalar dqdM = fwd - rev;\n";
+        }
+        else if (fallOff)
+        {
+            os  << "        const scalar dqdM = dkfdM*("
+                << (
+                       mech.forward(r)
+                     ? product(rStart, rID, rNu, r)
+                     : string("0")
+                   )
+                << (
+                       mech.backward(r)
+                     ? " - " + product(pStart, pID, pNu, r) + "/Kc"
+                     : string("")
+                   )
+                << ");\n";
+        }
+
+        for
+        (
+            int i = mech.efficiencyStart()[tb];
+            i < mech.efficiencyStart()[tb+1];
+            ++i
+        )
+        {
+            cols.push_back(mech.efficiencyID()[i]);
+            exprs.push_back
+            (
+                linear
+                (
+                    scalarField{mech.efficiency()[i]},
+                    wordList{"dqdM"}
+                )
+            );
+        }
+    }
+
+    //- d(omega_s)/d(c_j) += nu_s d(q)/d(c_j)
+    forEach(cols, k)
+    {
+        os  << "        {\n"
+            << "            const scalar d = " << exprs[k] << ";\n";
+
+        for (int i = mech.netStart()[r]; i < mech.netStart()[r+1]; ++i)
+        {
+            const int nu = mech.netNu()[i];
+
+            os  << "            J[" << mech.netID()[i] << "*nS + " << cols[k]
+                << "] " << (nu > 0 ? "+= " : "-= ")
+                << (abs(nu) == 1 ? string("d") : toStr(abs(nu)) + "*d")
+                << ";\n";
+        }
+
+        os  << "        }\n";
+    }
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,139 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryGenerator
+
+Description
+    Writes a standalone C++ translation unit that implements the interface
+    of TKC::ChemistryGenerated for one fixed mechanism. All coefficients,
+    the stochiometry and the third body efficiencies are written as
+    constants; integer powers of the concentrations are expanded into
+    products and vanishing terms are skipped. The analytical Jacobian
+    d(omega)/d(c) is always generated, as it is part of the interface.
+    PLOG reactions keep their pressure points; ln(k) is interpolated in
+    ln(p) for the pressure argument of the generated functions.
+
+SourceFiles
+    chemistryGenerator.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryGenerator_hpp
+#define ChemistryGenerator_hpp
+
+#include "chemistryCalc.hpp"
+#include "thermo.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                       Class ChemistryGenerator Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryGenerator
+{
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Reference to the thermo
+            const Thermo& thermo_;
+
+
+        // Private Member Functions
+
+            //- Return the scalar as floating point literal (full precision)
+            string num(const scalar) const;
+
+            //- Return the linear combination sum_i a_i*x_i as string, an
+            //  empty x_i is a constant, zero coefficients are skipped
+            string linear(const scalarField&, const wordList&) const;
+
+            //- Return the Arrhenius expression as function of lnT and rT
+            string arrhenius(const scalar, const scalar, const scalar) const;
+
+            //- Return the product of the concentrations (integer powers are
+            //  expanded), the entry skip (position in the CSR) is derived
+            string product
+            (
+                const List<int>&,
+                const List<int>&,
+                const List<int>&,
+                const int,
+                const int skip = -1
+            ) const;
+
+            //- Write the code that calculates [M] of reaction r
+            void writeM(ostream&, const int) const;
+
+            //- Write the code that calculates kf of reaction r
+            void writeKf(ostream&, const int) const;
+
+            //- Write the code that calculates Kc of reaction r
+            void writeKc(ostream&, const int) const;
+
+            //- Write g0/(RT) of all species
+            void writeGibbs(ostream&) const;
+
+            //- Write the fall off helper functions
+            void writeFallOff(ostream&) const;
+
+            //- Write the PLOG interpolation helper function
+            void writePLOG(ostream&) const;
+
+            //- Write the Jacobian of reaction r
+            void writeJacobian(ostream&, const int) const;
+
+
+    public:
+
+        //- Constructor
+        ChemistryGenerator(const ChemistryCalc&, const Thermo&);
+
+        //- Destructor
+        ~ChemistryGenerator();
+
+
+        // Member Functions
+
+            //- Write the translation unit (incl. the Jacobian)
+            void write(const string) const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryGenerator_hpp included
+
+// ************************************************************************* //
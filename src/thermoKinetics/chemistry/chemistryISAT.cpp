@@ -0,0 +1,549 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryISAT.hpp"
+#include <limits>
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryISAT::ChemistryISAT
+(
+    const mapping& map,
+    const scalarField& scalePhi,
+    const scalarField& scaleR,
+    const scalar tolerance,
+    const scalar maxMemory
+)
+:
+    mapping_(map),
+    scalePhi_(scalePhi),
+    scaleR_(scaleR),
+    tolerance_(tolerance)
+{
+    const size_t nPhi = scalePhi_.size();
+    const size_t nR = scaleR_.size();
+
+    //- Memory of one leaf and its two nodes
+    const scalar bytes =
+        sizeof(scalar) * (nPhi + nR + nR*nPhi + nPhi*nPhi + 2*nPhi)
+      + sizeof(Leaf) + 2*sizeof(Node);
+
+    maxLeaves_ = max(1, int(maxMemory * 1024 * 1024 / bytes));
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryISAT::~ChemistryISAT()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryISAT::gradient(const gradientMapping& gradient)
+{
+    gradient_ = gradient;
+}
+
+
+int TKC::ChemistryISAT::query
+(
+    const scalarField& phi,
+    scalarField& R
+)
+{
+    const int leaf = root_ != -1 ? search(phi) : -1;
+
+    if (leaf != -1)
+    {
+        //- Retrieve
+        if (inside(leaf, phi))
+        {
+            linear(leaf, phi, R);
+
+            lru_.splice(lru_.begin(), lru_, leaves_[leaf].lru);
+
+            ++nRetrieved_;
+
+            return retrieved;
+        }
+
+        //- Direct evaluation and grow if the linear approximation is
+        //  accurate enough
+        mapping_(phi, R);
+
+        if (error(leaf, phi, R) <= tolerance_)
+        {
+            grow(leaf, phi);
+
+            lru_.splice(lru_.begin(), lru_, leaves_[leaf].lru);
+
+            ++nGrown_;
+
+            return grown;
+        }
+    }
+    else
+    {
+        mapping_(phi, R);
+    }
+
+    //- Add a new leaf
+    add(phi, R);
+
+    ++nAdded_;
+
+    return added;
+}
+
+
+void TKC::ChemistryISAT::clear()
+{
+    nodes_.clear();
+    leaves_.clear();
+    freeNodes_.clear();
+    freeLeaves_.clear();
+    lru_.clear();
+    root_ = -1;
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+int TKC::ChemistryISAT::search(const scalarField& phi) const
+{
+    int node = root_;
+
+    while (nodes_[node].leaf == -1)
+    {
+        const Node& n = nodes_[node];
+
+        scalar vPhi{0};
+
+        forEach(phi, i)
+        {
+            vPhi += n.v[i] * phi[i];
+        }
+
+        node = vPhi > n.a ? n.right : n.left;
+    }
+
+    return nodes_[node].leaf;
+}
+
+
+bool TKC::ChemistryISAT::inside
+(
+    const int leaf,
+    const scalarField& phi
+) const
+{
+    const Leaf& l = leaves_[leaf];
+
+    const int nPhi = phi.size();
+
+    scalarField d(nPhi);
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        d[i] = (phi[i] - l.phi[i]) / scalePhi_[i];
+    }
+
+    //- d^T M d
+    scalar q{0};
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        scalar Md{0};
+
+        for (int j = 0; j < nPhi; ++j)
+        {
+            Md += l.M[i*nPhi + j] * d[j];
+        }
+
+        q += d[i] * Md;
+    }
+
+    return q <= 1;
+}
+
+
+void TKC::ChemistryISAT::linear
+(
+    const int leaf,
+    const scalarField& phi,
+    scalarField& R
+) const
+{
+    const Leaf& l = leaves_[leaf];
+
+    const int nPhi = phi.size();
+    const int nR = l.R.size();
+
+    R = l.R;
+
+    for (int i = 0; i < nR; ++i)
+    {
+        for (int j = 0; j < nPhi; ++j)
+        {
+            R[i] += l.A[i*nPhi + j] * (phi[j] - l.phi[j]);
+        }
+    }
+}
+
+
+TKC::scalar TKC::ChemistryISAT::error
+(
+    const int leaf,
+    const scalarField& phi,
+    const scalarField& R
+) const
+{
+    scalarField RLinear;
+
+    linear(leaf, phi, RLinear);
+
+    scalar err{0};
+
+    forEach(R, i)
+    {
+        const scalar e = (R[i] - RLinear[i]) / scaleR_[i];
+
+        err += e*e;
+    }
+
+    return sqrt(err);
+}
+
+
+void TKC::ChemistryISAT::grow
+(
+    const int leaf,
+    const scalarField& phi
+)
+{
+    Leaf& l = leaves_[leaf];
+
+    const int nPhi = phi.size();
+
+    scalarField d(nPhi);
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        d[i] = (phi[i] - l.phi[i]) / scalePhi_[i];
+    }
+
+    //- m = M d and q = d^T M d
+    scalarField m(nPhi, 0);
+    scalar q{0};
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        for (int j = 0; j < nPhi; ++j)
+        {
+            m[i] += l.M[i*nPhi + j] * d[j];
+        }
+
+        q += d[i] * m[i];
+    }
+
+    if (q <= 1)
+    {
+        return;
+    }
+
+    //- Rank one update M' = M - (1 - 1/q)/q m m^T, hence d^T M' d = 1 and
+    //  M' <= M (the old EOA is still included)
+    const scalar f = (1 - 1/q) / q;
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        for (int j = 0; j < nPhi; ++j)
+        {
+            l.M[i*nPhi + j] -= f * m[i] * m[j];
+        }
+    }
+}
+
+
+void TKC::ChemistryISAT::add
+(
+    const scalarField& phi,
+    const scalarField& R
+)
+{
+    if (int(lru_.size()) >= maxLeaves_)
+    {
+        evict();
+    }
+
+    //- Nearest leaf after a possible eviction
+    const int nearLeaf = root_ != -1 ? search(phi) : -1;
+
+    const int nPhi = phi.size();
+    const int nR = R.size();
+
+    const int leaf = newLeaf();
+
+    Leaf& l = leaves_[leaf];
+
+    l.phi = phi;
+    l.R = R;
+    l.A.assign(nR*nPhi, 0);
+
+    //- Mapping gradient
+    if (gradient_)
+    {
+        scalarField RGrad;
+
+        gradient_(phi, RGrad, l.A);
+    }
+    else
+    {
+        const scalar eps = sqrt(std::numeric_limits<scalar>::epsilon());
+
+        scalarField phiH = phi;
+        scalarField RH;
+
+        for (int j = 0; j < nPhi; ++j)
+        {
+            const scalar h = eps * max(scalar(fabs(phi[j])), scalePhi_[j]);
+
+            phiH[j] = phi[j] + h;
+
+            mapping_(phiH, RH);
+
+            for (int i = 0; i < nR; ++i)
+            {
+                l.A[i*nPhi + j] = (RH[i] - R[i]) / h;
+            }
+
+            phiH[j] = phi[j];
+        }
+    }
+
+    //- EOA out of the scaled gradient, M = A^T A / tol^2 + I
+    l.M.assign(nPhi*nPhi, 0);
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        for (int j = 0; j < nPhi; ++j)
+        {
+            scalar ATA{0};
+
+            for (int k = 0; k < nR; ++k)
+            {
+                ATA +=
+                    l.A[k*nPhi + i] * l.A[k*nPhi + j]
+                  * scalePhi_[i] * scalePhi_[j] / (scaleR_[k] * scaleR_[k]);
+            }
+
+            l.M[i*nPhi + j] =
+                ATA / (tolerance_ * tolerance_) + (i == j ? 1 : 0);
+        }
+    }
+
+    //- Leaf node
+    const int node = newNode();
+
+    nodes_[node].leaf = leaf;
+    l.node = node;
+
+    lru_.push_front(leaf);
+    l.lru = lru_.begin();
+
+    if (nearLeaf == -1)
+    {
+        root_ = node;
+        return;
+    }
+
+    //- Cutting plane between the nearest leaf (left) and the new leaf
+    const int nearNode = leaves_[nearLeaf].node;
+
+    const int cut = newNode();
+
+    Node& c = nodes_[cut];
+
+    c.v.resize(nPhi);
+    c.a = 0;
+
+    for (int i = 0; i < nPhi; ++i)
+    {
+        c.v[i] =
+            (phi[i] - leaves_[nearLeaf].phi[i])
+          / (scalePhi_[i] * scalePhi_[i]);
+
+        c.a += c.v[i] * (phi[i] + leaves_[nearLeaf].phi[i]) / 2;
+    }
+
+    //- Replace the found leaf node by the cutting plane
+    const int parent = nodes_[nearNode].parent;
+
+    c.parent = parent;
+    c.left = nearNode;
+    c.right = node;
+
+    if (parent == -1)
+    {
+        root_ = cut;
+    }
+    else if (nodes_[parent].left == nearNode)
+    {
+        nodes_[parent].left = cut;
+    }
+    else
+    {
+        nodes_[parent].right = cut;
+    }
+
+    nodes_[nearNode].parent = cut;
+    nodes_[node].parent = cut;
+}
+
+
+void TKC::ChemistryISAT::evict()
+{
+    const int leaf = lru_.back();
+
+    lru_.pop_back();
+
+    const int node = leaves_[leaf].node;
+    const int parent = nodes_[node].parent;
+
+    if (parent == -1)
+    {
+        root_ = -1;
+    }
+    else
+    {
+        //- The sibling replaces the parent
+        const int sibling =
+            nodes_[parent].left == node
+          ? nodes_[parent].right
+          : nodes_[parent].left;
+
+        const int grandParent = nodes_[parent].parent;
+
+        nodes_[sibling].parent = grandParent;
+
+        if (grandParent == -1)
+        {
+            root_ = sibling;
+        }
+        else if (nodes_[grandParent].left == parent)
+        {
+            nodes_[grandParent].left = sibling;
+        }
+        else
+        {
+            nodes_[grandParent].right = sibling;
+        }
+
+        nodes_[parent] = Node();
+        freeNodes_.push_back(parent);
+    }
+
+    nodes_[node] = Node();
+    freeNodes_.push_back(node);
+
+    leaves_[leaf] = Leaf();
+    freeLeaves_.push_back(leaf);
+
+    ++nEvicted_;
+}
+
+
+int TKC::ChemistryISAT::newNode()
+{
+    if (!freeNodes_.empty())
+    {
+        const int node = freeNodes_.back();
+        freeNodes_.pop_back();
+
+        return node;
+    }
+
+    nodes_.push_back(Node());
+
+    return nodes_.size() - 1;
+}
+
+
+int TKC::ChemistryISAT::newLeaf()
+{
+    if (!freeLeaves_.empty())
+    {
+        const int leaf = freeLeaves_.back();
+        freeLeaves_.pop_back();
+
+        return leaf;
+    }
+
+    leaves_.push_back(Leaf());
+
+    return leaves_.size() - 1;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::ChemistryISAT::nLeaves() const
+{
+    return lru_.size();
+}
+
+
+int TKC::ChemistryISAT::maxLeaves() const
+{
+    return maxLeaves_;
+}
+
+
+long TKC::ChemistryISAT::nRetrieved() const
+{
+    return nRetrieved_;
+}
+
+
+long TKC::ChemistryISAT::nGrown() const
+{
+    return nGrown_;
+}
+
+
+long TKC::ChemistryISAT::nAdded() const
+{
+    return nAdded_;
+}
+
+
+long TKC::ChemistryISAT::nEvicted() const
+{
+    return nEvicted_;
+}
+
+
+// ************************************************************************* //
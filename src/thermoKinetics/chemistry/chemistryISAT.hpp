@@ -0,0 +1,241 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryISAT
+
+Description
+    In situ adaptive tabulation (ISAT, Pope 1997) of a mapping R(phi),
+    e.g. the composition after a reaction time step of a reactor
+    integration. Each table entry (leaf) stores the query phi0, the
+    result R0, the mapping gradient A = dR/dphi and its ellipsoid of
+    accuracy (EOA) in scaled variables (dphi_i / scalePhi_i):
+
+        dphi^T M dphi <= 1,   M = A^T A / tol^2 + I
+
+    with A scaled by scalePhi and 1/scaleR; the identity bounds the EOA
+    to |dphi_i| <= scalePhi_i. A query is answered as follows:
+
+        retrieve: phi is inside the EOA of the leaf found in the binary
+                  tree, R = R0 + A (phi - phi0)
+        grow:     the mapping is evaluated directly; if the error of the
+                  linear approximation is <= tol, the EOA is grown by a
+                  rank one update to include phi
+        add:      otherwise the mapping gradient is evaluated (finite
+                  differences if no gradient function is set) and a new
+                  leaf is added to the tree
+
+    The leaves are evicted in least recently used order if the memory
+    limit is reached.
+
+SourceFiles
+    chemistryISAT.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryISAT_hpp
+#define ChemistryISAT_hpp
+
+#include "definitions.hpp"
+#include <functional>
+#include <list>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                        Class ChemistryISAT Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryISAT
+{
+    public:
+
+        //- Result of a query
+        enum queryResult
+        {
+            retrieved,
+            grown,
+            added
+        };
+
+        //- Mapping R(phi)
+        using mapping =
+            std::function<void(const scalarField&, scalarField&)>;
+
+        //- Mapping R(phi) and its gradient A (nR x nPhi, row major)
+        using gradientMapping =
+            std::function<void(const scalarField&, scalarField&, scalarField&)>;
+
+
+    private:
+
+        //- Table entry
+        struct Leaf
+        {
+            //- Query, result and mapping gradient (row major)
+            scalarField phi;
+            scalarField R;
+            scalarField A;
+
+            //- EOA in scaled variables (nPhi x nPhi, row major)
+            scalarField M;
+
+            //- Node of the leaf in the binary tree
+            int node{-1};
+
+            //- Position in the LRU list
+            std::list<int>::iterator lru;
+        };
+
+        //- Node of the binary tree, either a leaf or a cutting plane
+        //  v phi = a (phi with v phi > a is on the right side)
+        struct Node
+        {
+            int parent{-1};
+            int left{-1};
+            int right{-1};
+            int leaf{-1};
+            scalarField v;
+            scalar a{0};
+        };
+
+
+        // Private Data
+
+            //- Mapping and optional gradient mapping
+            mapping mapping_;
+            gradientMapping gradient_;
+
+            //- Scales of phi and R and the tolerance of the scaled error
+            scalarField scalePhi_;
+            scalarField scaleR_;
+            scalar tolerance_;
+
+            //- Maximum number of leaves (out of the memory limit)
+            int maxLeaves_;
+
+            //- Binary tree and the leaves, removed entries are reused
+            List<Node> nodes_;
+            List<Leaf> leaves_;
+            List<int> freeNodes_;
+            List<int> freeLeaves_;
+            int root_{-1};
+
+            //- Leaves in least recently used order (front = recent)
+            std::list<int> lru_;
+
+            //- Statistics
+            long nRetrieved_{0};
+            long nGrown_{0};
+            long nAdded_{0};
+            long nEvicted_{0};
+
+
+        // Private Member Functions
+
+            //- Return the leaf found by traversing the tree
+            int search(const scalarField&) const;
+
+            //- Check if phi is inside the EOA of the leaf
+            bool inside(const int, const scalarField&) const;
+
+            //- Linear approximation R0 + A (phi - phi0) of the leaf
+            void linear(const int, const scalarField&, scalarField&) const;
+
+            //- Scaled error of R with respect to the linear approximation
+            scalar error(const int, const scalarField&, const scalarField&)
+                const;
+
+            //- Grow the EOA of the leaf to include phi
+            void grow(const int, const scalarField&);
+
+            //- Evaluate the gradient and add a new leaf next to the leaf
+            //  found in the tree (the least recently used leaf is evicted
+            //  if the table is full)
+            void add(const scalarField&, const scalarField&);
+
+            //- Remove the least recently used leaf
+            void evict();
+
+            //- Return a free node or leaf
+            int newNode();
+            int newLeaf();
+
+
+    public:
+
+        //- Constructor with the mapping, the scales of phi and R, the
+        //  tolerance and the memory limit [MB]
+        ChemistryISAT
+        (
+            const mapping&,
+            const scalarField&,
+            const scalarField&,
+            const scalar,
+            const scalar maxMemory = 100
+        );
+
+        //- Destructor
+        ~ChemistryISAT();
+
+
+        // Member Functions
+
+            //- Set the gradient mapping (finite differences otherwise)
+            void gradient(const gradientMapping&);
+
+            //- Return R(phi) out of the table or by direct evaluation
+            int query(const scalarField&, scalarField&);
+
+            //- Remove all leaves
+            void clear();
+
+
+        // Return Functions
+
+            //- Return the number of leaves
+            int nLeaves() const;
+
+            //- Return the maximum number of leaves
+            int maxLeaves() const;
+
+            //- Return the number of retrieves, grows, adds and evictions
+            long nRetrieved() const;
+            long nGrown() const;
+            long nAdded() const;
+            long nEvicted() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryISAT_hpp included
+
+// ************************************************************************* //
@@ -0,0 +1,1084 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryMechanism.hpp"
+#include "chemistryData.hpp"
+#include "constants.hpp"
+#include <algorithm>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryMechanism::ChemistryMechanism()
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryMechanism::~ChemistryMechanism()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryMechanism::compile(const ChemistryData& data)
+{
+    const wordList& species = data.species();
+
+    nSpecies_ = species.size();
+    nReac_ = data.nReac();
+
+    //- Species IDs
+    speciesID_.clear();
+
+    forEach(species, s)
+    {
+        speciesID_[species[s]] = s;
+    }
+
+    //- Stochiometry and reaction properties
+    reactantStart_.assign(1, 0);
+    productStart_.assign(1, 0);
+    netStart_.assign(1, 0);
+
+    reactantID_.clear();
+    reactantNu_.clear();
+    productID_.clear();
+    productNu_.clear();
+    netID_.clear();
+    netNu_.clear();
+
+    forward_.assign(nReac_, false);
+    backward_.assign(nReac_, false);
+    type_.assign(nReac_, elementary);
+    dn_.assign(nReac_, 0);
+
+    A_.assign(nReac_, 0);
+    beta_.assign(nReac_, 0);
+    Ea_.assign(nReac_, 0);
+    lnA_.assign(nReac_, 0);
+    signA_.assign(nReac_, 0);
+    Ta_.assign(nReac_, 0);
+
+    thirdBodyReac_.clear();
+    thirdBodyIndex_.assign(nReac_, -1);
+    efficiencyStart_.assign(1, 0);
+    efficiencyID_.clear();
+    efficiency_.clear();
+    thirdBodyDefault_.clear();
+    enhancedStart_.assign(1, 0);
+    enhancedID_.clear();
+    enhancedDelta_.clear();
+
+    plogReac_.clear();
+    plogIndex_.assign(nReac_, -1);
+    plogStart_.assign(1, 0);
+
+    for (scalarField* field : {&plogLnP_, &plogLnA_, &plogBeta_, &plogTa_})
+    {
+        field->clear();
+    }
+
+    fallOffReac_.clear();
+    fallOffIndex_.assign(nReac_, -1);
+    fallOffType_.clear();
+
+    for
+    (
+        scalarField* field :
+        {
+            &lowA_, &lowBeta_, &lowEa_, &lowLnA_, &lowSignA_, &lowTa_,
+            &troeAlpha_, &troeT3_, &troeT1_,
+            &troeT2_, &sriA_, &sriB_, &sriC_, &sriD_, &sriE_
+        }
+    )
+    {
+        field->clear();
+    }
+
+    //- Species incidence, collected per species first
+    List<List<int>> inReaction(nSpecies_);
+
+    //- Fall off reactions of the formulations Lindemann, TROE and SRI
+    List<List<int>> fallOffOfType(3);
+
+    for (int r = 0; r < nReac_; ++r)
+    {
+        //- Net stochiometric factors, ordered by species ID
+        map<int, int> net;
+
+        loopMapConst(s, nu, data.nuEducts(r))
+        {
+            const int id = speciesID(s);
+
+            reactantID_.push_back(id);
+            reactantNu_.push_back(abs(nu));
+            net[id] += nu;
+            inReaction[id].push_back(r);
+        }
+
+        loopMapConst(s, nu, data.nuProducts(r))
+        {
+            const int id = speciesID(s);
+
+            productID_.push_back(id);
+            productNu_.push_back(nu);
+            net[id] += nu;
+            inReaction[id].push_back(r);
+        }
+
+        loopMapConst(id, nu, net)
+        {
+            if (nu != 0)
+            {
+                netID_.push_back(id);
+                netNu_.push_back(nu);
+            }
+        }
+
+        reactantStart_.push_back(reactantID_.size());
+        productStart_.push_back(productID_.size());
+        netStart_.push_back(netID_.size());
+
+        forward_[r] = data.forwardReaction(r);
+        backward_[r] = data.backwardReaction(r);
+        dn_[r] = data.globalReactionOrder(r);
+
+        const scalarField& arrCoeffs = data.arrheniusCoeffs(r);
+
+        A_[r] = arrCoeffs[0];
+        beta_[r] = arrCoeffs[1];
+        Ea_[r] = arrCoeffs[2];
+
+        //- Log form, A = 0 is covered by signA = 0 (no infinite values)
+        if (A_[r] != 0)
+        {
+            lnA_[r] = log(fabs(A_[r]));
+            signA_[r] = A_[r] > 0 ? 1 : -1;
+        }
+
+        Ta_[r] = Ea_[r] / Constants::Rcal;
+
+        //- Third body efficiencies
+        if (data.TBR(r))
+        {
+            type_[r] = data.LOW(r) ? fallOff : thirdBody;
+
+            thirdBodyIndex_[r] = thirdBodyReac_.size();
+            thirdBodyReac_.push_back(r);
+
+            //- Collision partner is either M or a distinct species (+AR)
+            word partner = data.collisionPartner(r);
+
+            for (const char c : {'(', ')', '+'})
+            {
+                partner.erase
+                (
+                    std::remove(partner.begin(), partner.end(), c),
+                    partner.end()
+                );
+            }
+
+            if (partner != "M" && speciesID_.count(partner))
+            {
+                efficiencyID_.push_back(speciesID(partner));
+                efficiency_.push_back(1);
+
+                thirdBodyDefault_.push_back(0);
+                enhancedID_.push_back(speciesID(partner));
+                enhancedDelta_.push_back(1);
+            }
+            else
+            {
+                const map<word, scalar>& enhanced = data.ENHANCEDCoeffs(r);
+
+                thirdBodyDefault_.push_back(1);
+
+                forEach(species, s)
+                {
+                    const scalar eff = enhanced.at(species[s]);
+
+                    if (eff != 0)
+                    {
+                        efficiencyID_.push_back(s);
+                        efficiency_.push_back(eff);
+                    }
+
+                    if (eff != 1)
+                    {
+                        enhancedID_.push_back(s);
+                        enhancedDelta_.push_back(eff - 1);
+                    }
+                }
+            }
+
+            efficiencyStart_.push_back(efficiencyID_.size());
+            enhancedStart_.push_back(enhancedID_.size());
+        }
+
+        //- Pressure points of PLOG reactions, sorted by pressure
+        if (data.PLOG(r))
+        {
+            const scalarField& coeffs = data.PLOGCoeffs(r);
+
+            //- (p, A, beta, Ea) per pressure
+            List<scalarField> points;
+
+            for (size_t i = 0; i + 3 < coeffs.size(); i += 4)
+            {
+                points.push_back
+                (
+                    {coeffs[i], coeffs[i+1], coeffs[i+2], coeffs[i+3]}
+                );
+            }
+
+            std::sort
+            (
+                points.begin(),
+                points.end(),
+                [](const scalarField& a, const scalarField& b)
+                {
+                    return a[0] < b[0];
+                }
+            );
+
+            forEach(points, i)
+            {
+                const scalarField& point = points[i];
+
+                //- The interpolation of ln(k) needs A > 0 and one
+                //  Arrhenius expression per pressure
+                if
+                (
+                    point[1] <= 0
+                 || (i > 0 && point[0] == points[i-1][0])
+                )
+                {
+                    ErrorMsg
+                    (
+                        "    PLOG reaction " + data.elementarReaction(r)
+                      + " has more than one Arrhenius expression for one\n"
+                        "    pressure or a non positive pre-exponential "
+                        "factor, which is not supported",
+                        __FILE__,
+                        __LINE__
+                    );
+                }
+
+                //- Pressure is given in [atm], 1 atm = 101325 Pa
+                plogLnP_.push_back(log(point[0] * 101325));
+                plogLnA_.push_back(log(point[1]));
+                plogBeta_.push_back(point[2]);
+                plogTa_.push_back(point[3] / Constants::Rcal);
+            }
+
+            plogIndex_[r] = plogReac_.size();
+            plogReac_.push_back(r);
+            plogStart_.push_back(plogLnP_.size());
+        }
+
+        //- Fall off reactions, collected per formulation
+        if (data.LOW(r))
+        {
+            if (data.SRI(r))
+            {
+                fallOffOfType[SRI].push_back(r);
+            }
+            else if (data.TROE(r))
+            {
+                fallOffOfType[TROE].push_back(r);
+            }
+            else
+            {
+                fallOffOfType[Lindemann].push_back(r);
+            }
+        }
+    }
+
+    //- Fall off parameters, rows are grouped by formulation such that each
+    //  formulation is a contiguous range [fallOffTypeStart()[t], [t+1])
+    fallOffTypeStart_.assign(1, 0);
+
+    for (const List<int>& reactions : fallOffOfType)
+    {
+        forAll(reactions, r)
+        {
+            fallOffIndex_[r] = fallOffReac_.size();
+            fallOffReac_.push_back(r);
+
+            if (data.SRI(r))
+            {
+                fallOffType_.push_back(SRI);
+            }
+            else if (data.TROE(r))
+            {
+                fallOffType_.push_back(TROE);
+            }
+            else
+            {
+                fallOffType_.push_back(Lindemann);
+            }
+
+            const scalarField& low = data.LOWCoeffs(r);
+            const scalarField& troe = data.TROECoeffs(r);
+            const scalarField& sri = data.SRICoeffs(r);
+
+            lowA_.push_back(low[0]);
+            lowBeta_.push_back(low[1]);
+            lowEa_.push_back(low[2]);
+
+            //- Log form of the low pressure limit (see lnA_)
+            lowLnA_.push_back(low[0] != 0 ? log(fabs(low[0])) : 0);
+            lowSignA_.push_back(low[0] > 0 ? 1 : (low[0] < 0 ? -1 : 0));
+            lowTa_.push_back(low[2] / Constants::Rcal);
+
+            troeAlpha_.push_back(troe[0]);
+            troeT3_.push_back(troe[1]);
+            troeT1_.push_back(troe[2]);
+            troeT2_.push_back(troe[3]);
+
+            sriA_.push_back(sri[0]);
+            sriB_.push_back(sri[1]);
+            sriC_.push_back(sri[2]);
+            sriD_.push_back(sri[3]);
+            sriE_.push_back(sri[4]);
+        }
+
+        fallOffTypeStart_.push_back(fallOffReac_.size());
+    }
+
+    //- Species to reaction incidence (unique and ordered)
+    speciesReacStart_.assign(1, 0);
+    speciesReacID_.clear();
+
+    forAll(inReaction, reactions)
+    {
+        std::sort(reactions.begin(), reactions.end());
+
+        reactions.erase
+        (
+            std::unique(reactions.begin(), reactions.end()),
+            reactions.end()
+        );
+
+        speciesReacID_.insert
+        (
+            speciesReacID_.end(),
+            reactions.begin(),
+            reactions.end()
+        );
+
+        speciesReacStart_.push_back(speciesReacID_.size());
+    }
+
+    //- Net stochiometric factors of the incidence (0 if the species is
+    //  not converted, e.g. A + B = A + C)
+    speciesReacNu_.assign(speciesReacID_.size(), 0);
+
+    for (int s = 0; s < nSpecies_; ++s)
+    {
+        for (int i = speciesReacStart_[s]; i < speciesReacStart_[s+1]; ++i)
+        {
+            const int r = speciesReacID_[i];
+
+            for (int j = netStart_[r]; j < netStart_[r+1]; ++j)
+            {
+                if (netID_[j] == s)
+                {
+                    speciesReacNu_[i] = netNu_[j];
+                }
+            }
+        }
+    }
+
+    //- Multiplication only concentration products
+    classifyProducts();
+
+    //- Symbolic structure of the Jacobian
+    buildJacobianPattern();
+
+    //- PLOG reactions at the reference pressure until the actual one is set
+    pressure_ = -1;
+    resolvedPressure_ = -1;
+    pressure(Constants::p0);
+}
+
+
+TKC::scalarField TKC::ChemistryMechanism::concentrations
+(
+    const map<word, scalar>& c
+) const
+{
+    scalarField con(nSpecies_, scalar(0));
+
+    loopMapConst(species, value, c)
+    {
+        const auto it = speciesID_.find(species);
+
+        if (it != speciesID_.end())
+        {
+            con[it->second] = value;
+        }
+    }
+
+    return con;
+}
+
+
+void TKC::ChemistryMechanism::plog
+(
+    const int i,
+    const scalar lnP,
+    scalar& lnA,
+    scalar& beta,
+    scalar& Ta
+) const
+{
+    const int first = plogStart_[i];
+    const int last = plogStart_[i+1] - 1;
+
+    //- Outside of the given pressures the limits are used
+    if (lnP <= plogLnP_[first] || lnP >= plogLnP_[last])
+    {
+        const int j = lnP <= plogLnP_[first] ? first : last;
+
+        lnA = plogLnA_[j];
+        beta = plogBeta_[j];
+        Ta = plogTa_[j];
+
+        return;
+    }
+
+    //- Bracket lnP_j < lnP <= lnP_j+1
+    int j = first;
+
+    while (lnP > plogLnP_[j+1])
+    {
+        ++j;
+    }
+
+    //- ln(k) linear in ln(p), hence also lnA, beta and Ta
+    const scalar w = (lnP - plogLnP_[j]) / (plogLnP_[j+1] - plogLnP_[j]);
+
+    lnA = plogLnA_[j] + w * (plogLnA_[j+1] - plogLnA_[j]);
+    beta = plogBeta_[j] + w * (plogBeta_[j+1] - plogBeta_[j]);
+    Ta = plogTa_[j] + w * (plogTa_[j+1] - plogTa_[j]);
+}
+
+
+void TKC::ChemistryMechanism::pressure(const scalar p) const
+{
+    //- Already resolved, no lock needed
+    if (double(p) == resolvedPressure_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(plogMutex_);
+
+    //- Resolved by another thread meanwhile
+    if (double(p) == resolvedPressure_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (plogReac_.empty())
+    {
+        pressure_ = p;
+        resolvedPressure_.store(double(p), std::memory_order_release);
+
+        return;
+    }
+
+    const scalar lnP = log(p);
+
+    forEach(plogReac_, i)
+    {
+        const int r = plogReac_[i];
+
+        plog(i, lnP, lnA_[r], beta_[r], Ta_[r]);
+
+        A_[r] = exp(lnA_[r]);
+        signA_[r] = 1;
+        Ea_[r] = Ta_[r] * Constants::Rcal;
+    }
+
+    pressure_ = p;
+    resolvedPressure_.store(double(p), std::memory_order_release);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::ChemistryMechanism::classifyProducts()
+{
+    reactantOrder_.assign(nReac_, 0);
+    productOrder_.assign(nReac_, 0);
+    reactantFactor_.assign(3*nReac_, 0);
+    productFactor_.assign(3*nReac_, 0);
+
+    auto classify = [&]
+    (
+        const List<int>& start,
+        const List<int>& id,
+        const List<int>& nu,
+        List<int>& order,
+        List<int>& factor
+    )
+    {
+        for (int r = 0; r < nReac_; ++r)
+        {
+            int n{0};
+
+            for (int i = start[r]; i < start[r+1]; ++i)
+            {
+                n += nu[i];
+            }
+
+            if (n < 1 || n > 3)
+            {
+                continue;
+            }
+
+            order[r] = n;
+
+            int k = 3*r;
+
+            for (int i = start[r]; i < start[r+1]; ++i)
+            {
+                for (int j = 0; j < nu[i]; ++j)
+                {
+                    factor[k++] = id[i];
+                }
+            }
+        }
+    };
+
+    classify
+    (
+        reactantStart_,
+        reactantID_,
+        reactantNu_,
+        reactantOrder_,
+        reactantFactor_
+    );
+
+    classify
+    (
+        productStart_,
+        productID_,
+        productNu_,
+        productOrder_,
+        productFactor_
+    );
+}
+
+
+void TKC::ChemistryMechanism::buildJacobianPattern()
+{
+    //- Columns j with d(q_r)/d(c_j) != 0 of reaction r; same order as in
+    //  ChemistryCalc::rateOfProgressDerivatives (reactants, products and
+    //  the third body species)
+    List<List<int>> derivatives(nReac_);
+
+    for (int r = 0; r < nReac_; ++r)
+    {
+        List<int>& cols = derivatives[r];
+
+        for (int i = reactantStart_[r]; i < reactantStart_[r+1]; ++i)
+        {
+            cols.push_back(reactantID_[i]);
+        }
+
+        for (int i = productStart_[r]; i < productStart_[r+1]; ++i)
+        {
+            cols.push_back(productID_[i]);
+        }
+
+        const int tb = thirdBodyIndex_[r];
+
+        if (tb != -1)
+        {
+            for (int i = efficiencyStart_[tb]; i < efficiencyStart_[tb+1]; ++i)
+            {
+                cols.push_back(efficiencyID_[i]);
+            }
+        }
+    }
+
+    //- Row s depends on all columns of the reactions species s is
+    //  included in (species to reaction incidence)
+    List<List<int>> pattern(nSpecies_);
+
+    for (int s = 0; s < nSpecies_; ++s)
+    {
+        for (int i = speciesReacStart_[s]; i < speciesReacStart_[s+1]; ++i)
+        {
+            const List<int>& cols = derivatives[speciesReacID_[i]];
+
+            pattern[s].insert(pattern[s].end(), cols.begin(), cols.end());
+        }
+
+        std::sort(pattern[s].begin(), pattern[s].end());
+
+        pattern[s].erase
+        (
+            std::unique(pattern[s].begin(), pattern[s].end()),
+            pattern[s].end()
+        );
+    }
+
+    jacobianStructure_ = pattern;
+
+    //- Reordered structure incl. diagonal and LU fill-in
+    jacobianPattern_ = SparseMatrix(pattern);
+
+    //- Addressing for the numerical refill
+    jacobianAddr_.clear();
+
+    for (int r = 0; r < nReac_; ++r)
+    {
+        for (int i = netStart_[r]; i < netStart_[r+1]; ++i)
+        {
+            forAll(derivatives[r], j)
+            {
+                jacobianAddr_.push_back(jacobianPattern_.find(netID_[i], j));
+            }
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::ChemistryMechanism::nSpecies() const
+{
+    return nSpecies_;
+}
+
+
+int TKC::ChemistryMechanism::nReac() const
+{
+    return nReac_;
+}
+
+
+int TKC::ChemistryMechanism::speciesID(const word species) const
+{
+    return speciesID_.at(species);
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::reactantStart() const
+{
+    return reactantStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::reactantID() const
+{
+    return reactantID_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::reactantNu() const
+{
+    return reactantNu_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::productStart() const
+{
+    return productStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::productID() const
+{
+    return productID_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::productNu() const
+{
+    return productNu_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::reactantOrder() const
+{
+    return reactantOrder_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::productOrder() const
+{
+    return productOrder_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::reactantFactor() const
+{
+    return reactantFactor_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::productFactor() const
+{
+    return productFactor_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::netStart() const
+{
+    return netStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::netID() const
+{
+    return netID_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::netNu() const
+{
+    return netNu_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::speciesReacStart() const
+{
+    return speciesReacStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::speciesReacID() const
+{
+    return speciesReacID_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::speciesReacNu() const
+{
+    return speciesReacNu_;
+}
+
+
+bool TKC::ChemistryMechanism::forward(const int r) const
+{
+    return forward_[r];
+}
+
+
+bool TKC::ChemistryMechanism::backward(const int r) const
+{
+    return backward_[r];
+}
+
+
+int TKC::ChemistryMechanism::type(const int r) const
+{
+    return type_[r];
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::dn() const
+{
+    return dn_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::A() const
+{
+    return A_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::beta() const
+{
+    return beta_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::Ea() const
+{
+    return Ea_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lnA() const
+{
+    return lnA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::signA() const
+{
+    return signA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::Ta() const
+{
+    return Ta_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::thirdBodyReac() const
+{
+    return thirdBodyReac_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::thirdBodyIndex() const
+{
+    return thirdBodyIndex_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::efficiencyStart() const
+{
+    return efficiencyStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::efficiencyID() const
+{
+    return efficiencyID_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::efficiency() const
+{
+    return efficiency_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::thirdBodyDefault() const
+{
+    return thirdBodyDefault_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::enhancedStart() const
+{
+    return enhancedStart_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::enhancedID() const
+{
+    return enhancedID_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::enhancedDelta() const
+{
+    return enhancedDelta_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::plogReac() const
+{
+    return plogReac_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::plogIndex() const
+{
+    return plogIndex_;
+}
+
+
+TKC::scalar TKC::ChemistryMechanism::pressure() const
+{
+    return pressure_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::plogStart() const
+{
+    return plogStart_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::plogLnP() const
+{
+    return plogLnP_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::plogLnA() const
+{
+    return plogLnA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::plogBeta() const
+{
+    return plogBeta_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::plogTa() const
+{
+    return plogTa_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::fallOffReac() const
+{
+    return fallOffReac_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::fallOffIndex() const
+{
+    return fallOffIndex_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::fallOffType() const
+{
+    return fallOffType_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowA() const
+{
+    return lowA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowBeta() const
+{
+    return lowBeta_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowEa() const
+{
+    return lowEa_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::fallOffTypeStart() const
+{
+    return fallOffTypeStart_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowLnA() const
+{
+    return lowLnA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowSignA() const
+{
+    return lowSignA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::lowTa() const
+{
+    return lowTa_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::troeAlpha() const
+{
+    return troeAlpha_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::troeT3() const
+{
+    return troeT3_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::troeT1() const
+{
+    return troeT1_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::troeT2() const
+{
+    return troeT2_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::sriA() const
+{
+    return sriA_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::sriB() const
+{
+    return sriB_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::sriC() const
+{
+    return sriC_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::sriD() const
+{
+    return sriD_;
+}
+
+
+const TKC::scalarField& TKC::ChemistryMechanism::sriE() const
+{
+    return sriE_;
+}
+
+
+const TKC::SparseMatrix& TKC::ChemistryMechanism::jacobianPattern() const
+{
+    return jacobianPattern_;
+}
+
+
+const TKC::List<TKC::List<int>>&
+TKC::ChemistryMechanism::jacobianStructure() const
+{
+    return jacobianStructure_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryMechanism::jacobianAddr() const
+{
+    return jacobianAddr_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,455 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryMechanism
+
+Description
+    Compiled, index based representation of the chemistry data. It is built
+    once after the ChemistryReader finished and holds everything the
+    kinetic calculation needs in flat arrays:
+
+    + species are addressed by their position in ChemistryData::species()
+    + stochiometry in CSR format (rows = reactions), e.g. the reactants of
+      reaction r are reactantID()[reactantStart()[r] ... [r+1]-1]
+    + the species to reaction incidence in CSR format (rows = species)
+      including the net stochiometric factors, i.e. the transposed net
+      stochiometry; omega of species s can be gathered without a scatter
+    + Arrhenius, LOW, TROE and SRI coefficients as contiguous fields (SoA)
+    + third body efficiencies in CSR format (rows = third body reactions),
+      additionally as default efficiency plus sparse deltas
+    + PLOG reactions as pressure points in CSR format (rows = PLOG
+      reactions); ln(k) is interpolated linearly in ln(p), hence the
+      interpolation of lnA, beta and Ta is again an Arrhenius expression.
+      It is resolved once per pressure change into the Arrhenius fields
+      (see pressure()) and costs nothing during the evaluation; the
+      resolution is locked, concurrent evaluations (e.g. the threads of a
+      ChemistryDriver) have to use the same pressure
+    + the symbolic structure of the sparse Jacobian d(omega)/d(c)
+    + the signature of the concentration products; sides with an order
+      <= 3 (e.g. A + B or 2A) are expanded into single factors, such that
+      the rate of progress needs no loop over the side; higher orders use
+      repeated multiplications (integerPow) of each factor
+
+    Hence, no std::string or std::map is touched during the evaluation.
+
+SourceFiles
+    chemistryMechanism.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryMechanism_hpp
+#define ChemistryMechanism_hpp
+
+#include "definitions.hpp"
+#include "sparseMatrix.hpp"
+#include <atomic>
+#include <mutex>
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+class ChemistryData;
+
+/*---------------------------------------------------------------------------*\
+                      Class ChemistryMechanism Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryMechanism
+{
+    public:
+
+        //- Reaction type
+        enum reactionType
+        {
+            elementary,
+            thirdBody,
+            fallOff
+        };
+
+        //- Fall off formulation
+        enum fallOffType
+        {
+            Lindemann,
+            TROE,
+            SRI
+        };
+
+
+    private:
+
+        // Private data
+
+            //- Number of species
+            int nSpecies_{0};
+
+            //- Number of reactions
+            int nReac_{0};
+
+            //- Species name to species ID (only used at the interfaces)
+            map<word, int> speciesID_;
+
+
+        // Stochiometry (CSR, rows = reactions)
+
+            //- Reactants of reaction r, nu' stored positive
+            List<int> reactantStart_;
+            List<int> reactantID_;
+            List<int> reactantNu_;
+
+            //- Products of reaction r, nu''
+            List<int> productStart_;
+            List<int> productID_;
+            List<int> productNu_;
+
+            //- Net stochiometric factors nu'' - nu' (only non-zero entries)
+            List<int> netStart_;
+            List<int> netID_;
+            List<int> netNu_;
+
+            //- Order of the reactant and product side if it expands into
+            //  at most three single factors (e.g. 2A + B -> c_A c_A c_B),
+            //  0 for the general path (pow)
+            List<int> reactantOrder_;
+            List<int> productOrder_;
+
+            //- Expanded factors, three species IDs per reaction (unused
+            //  entries are 0)
+            List<int> reactantFactor_;
+            List<int> productFactor_;
+
+
+        // Incidence (CSR, rows = species)
+
+            //- Reactions in which species s is included
+            List<int> speciesReacStart_;
+            List<int> speciesReacID_;
+
+            //- Net stochiometric factor of species s in these reactions
+            List<int> speciesReacNu_;
+
+
+        // Reaction properties
+
+            //- Forward reaction possible
+            List<bool> forward_;
+
+            //- Backward reaction possible
+            List<bool> backward_;
+
+            //- Type of the reaction
+            List<int> type_;
+
+            //- Change in moles (global reaction order), exponent of Keq
+            scalarField dn_;
+
+
+        // Arrhenius coefficients (SoA)
+        //  mutable: the rows of the PLOG reactions hold the interpolated
+        //  coefficients of the actual pressure (see pressure())
+
+            //- Pre-exponential factor [units depend]
+            mutable scalarField A_;
+
+            //- Temperature exponent [-]
+            mutable scalarField beta_;
+
+            //- Activation energy [cal/mol]
+            mutable scalarField Ea_;
+
+            //- Log form for the vectorized evaluation
+            //  k = signA * exp(lnA + beta*lnT - Ta/T)
+            mutable scalarField lnA_;
+            mutable scalarField signA_;
+
+            //- Activation temperature Ea/Rcal [K]
+            mutable scalarField Ta_;
+
+
+        // Third body reactions (incl. fall off reactions)
+
+            //- Reaction no. of the third body reactions
+            List<int> thirdBodyReac_;
+
+            //- Row in the third body arrays for reaction r, -1 if none
+            List<int> thirdBodyIndex_;
+
+            //- Efficiencies of the species (CSR, rows = third body reaction)
+            List<int> efficiencyStart_;
+            List<int> efficiencyID_;
+            scalarField efficiency_;
+
+            //- Efficiency matrix as default plus sparse deltas (rows = third
+            //  body reaction): [M] = default*sum_j c_j + sum_j delta_j c_j
+            //  The default is 1 for +M and 0 for a distinct partner (+AR)
+            scalarField thirdBodyDefault_;
+            List<int> enhancedStart_;
+            List<int> enhancedID_;
+            scalarField enhancedDelta_;
+
+
+        // Fall off reactions (SoA, rows = fall off reaction)
+
+            //- Reaction no. of the fall off reactions, the rows are grouped
+            //  by the formulation (Lindemann, TROE, SRI)
+            List<int> fallOffReac_;
+
+            //- First row of each formulation (size 4), e.g. the TROE rows
+            //  are fallOffTypeStart_[TROE] ... [TROE+1]-1
+            List<int> fallOffTypeStart_;
+
+            //- Row in the fall off arrays for reaction r, -1 if none
+            List<int> fallOffIndex_;
+
+            //- Fall off formulation
+            List<int> fallOffType_;
+
+            //- LOW Arrhenius coefficients
+            scalarField lowA_;
+            scalarField lowBeta_;
+            scalarField lowEa_;
+
+            //- Log form of the LOW coefficients (see lnA_, signA_, Ta_)
+            scalarField lowLnA_;
+            scalarField lowSignA_;
+            scalarField lowTa_;
+
+            //- TROE coefficients (alpha, T***, T*, T**)
+            scalarField troeAlpha_;
+            scalarField troeT3_;
+            scalarField troeT1_;
+            scalarField troeT2_;
+
+            //- SRI coefficients (a, b, c, d, e)
+            scalarField sriA_;
+            scalarField sriB_;
+            scalarField sriC_;
+            scalarField sriD_;
+            scalarField sriE_;
+
+
+        // Pressure dependent reactions (PLOG, rows = PLOG reaction)
+
+            //- Reaction no. of the PLOG reactions
+            List<int> plogReac_;
+
+            //- Row in the PLOG arrays for reaction r, -1 if none
+            List<int> plogIndex_;
+
+            //- Pressure points of each row (CSR, ascending pressure):
+            //  ln(p [Pa]) and the log form of the Arrhenius coefficients
+            List<int> plogStart_;
+            scalarField plogLnP_;
+            scalarField plogLnA_;
+            scalarField plogBeta_;
+            scalarField plogTa_;
+
+            //- Pressure of the interpolated PLOG coefficients [Pa]
+            mutable scalar pressure_{-1};
+
+            //- Resolved pressure for the check without lock (set after
+            //  all coefficients are written) and the lock of the update
+            mutable std::atomic<double> resolvedPressure_{-1};
+            mutable std::mutex plogMutex_;
+
+
+        // Jacobian
+
+            //- Symbolic structure of d(omega)/d(c) (reordered, incl. LU
+            //  fill-in), the values are refilled for each evaluation
+            SparseMatrix jacobianPattern_;
+
+            //- Non-zero columns of each row of d(omega)/d(c) (original
+            //  order, without fill-in), e.g. to extend the system
+            List<List<int>> jacobianStructure_;
+
+            //- Position in the Jacobian values for each combination of the
+            //  net stochiometry and the derivative entries of reaction r in
+            //  the order of ChemistryCalc::rateOfProgressDerivatives
+            List<int> jacobianAddr_;
+
+
+        // Private Member Functions
+
+            //- Build the structure of the Jacobian out of the incidence
+            void buildJacobianPattern();
+
+            //- Classify the concentration products of all reactions and
+            //  expand the sides of order <= 3 into single factors
+            void classifyProducts();
+
+
+    public:
+
+        //- Constructor
+        ChemistryMechanism();
+
+        //- Destructor
+        ~ChemistryMechanism();
+
+
+        // Member Functions
+
+            //- Build the compiled mechanism out of the chemistry data
+            void compile(const ChemistryData&);
+
+            //- Convert a concentration map into a field ordered by species ID
+            scalarField concentrations(const map<word, scalar>&) const;
+
+            //- Interpolate the Arrhenius coefficients (lnA, beta, Ta) of
+            //  PLOG row i for ln(p [Pa]); outside of the given pressures
+            //  the first or last pressure is used
+            void plog
+            (
+                const int,
+                const scalar,
+                scalar&,
+                scalar&,
+                scalar&
+            ) const;
+
+            //- Update the Arrhenius coefficients of the PLOG reactions for
+            //  the pressure [Pa], nothing is done if it did not change
+            //  (thread safe for the same pressure)
+            void pressure(const scalar) const;
+
+
+        // Return Functions
+
+            //- Return number of species
+            int nSpecies() const;
+
+            //- Return number of reactions
+            int nReac() const;
+
+            //- Return the species ID of species s
+            int speciesID(const word) const;
+
+            //- Return the stochiometry arrays
+            const List<int>& reactantStart() const;
+            const List<int>& reactantID() const;
+            const List<int>& reactantNu() const;
+            const List<int>& productStart() const;
+            const List<int>& productID() const;
+            const List<int>& productNu() const;
+            const List<int>& netStart() const;
+            const List<int>& netID() const;
+            const List<int>& netNu() const;
+
+            //- Return the classified concentration products
+            const List<int>& reactantOrder() const;
+            const List<int>& productOrder() const;
+            const List<int>& reactantFactor() const;
+            const List<int>& productFactor() const;
+
+            //- Return the species to reaction incidence
+            const List<int>& speciesReacStart() const;
+            const List<int>& speciesReacID() const;
+            const List<int>& speciesReacNu() const;
+
+            //- Return if forward reaction r is possible
+            bool forward(const int) const;
+
+            //- Return if backward reaction r is possible
+            bool backward(const int) const;
+
+            //- Return the type of reaction r
+            int type(const int) const;
+
+            //- Return the change in moles of all reactions
+            const scalarField& dn() const;
+
+            //- Return the Arrhenius coefficients of all reactions
+            const scalarField& A() const;
+            const scalarField& beta() const;
+            const scalarField& Ea() const;
+
+            //- Return the log form of the Arrhenius coefficients
+            const scalarField& lnA() const;
+            const scalarField& signA() const;
+            const scalarField& Ta() const;
+
+            //- Return the third body arrays
+            const List<int>& thirdBodyReac() const;
+            const List<int>& thirdBodyIndex() const;
+            const List<int>& efficiencyStart() const;
+            const List<int>& efficiencyID() const;
+            const scalarField& efficiency() const;
+            const scalarField& thirdBodyDefault() const;
+            const List<int>& enhancedStart() const;
+            const List<int>& enhancedID() const;
+            const scalarField& enhancedDelta() const;
+
+            //- Return the PLOG reactions and the actual pressure [Pa]
+            const List<int>& plogReac() const;
+            const List<int>& plogIndex() const;
+            scalar pressure() const;
+
+            //- Return the pressure points of the PLOG reactions (CSR)
+            const List<int>& plogStart() const;
+            const scalarField& plogLnP() const;
+            const scalarField& plogLnA() const;
+            const scalarField& plogBeta() const;
+            const scalarField& plogTa() const;
+
+            //- Return the fall off arrays
+            const List<int>& fallOffReac() const;
+            const List<int>& fallOffIndex() const;
+            const List<int>& fallOffType() const;
+            const List<int>& fallOffTypeStart() const;
+            const scalarField& lowA() const;
+            const scalarField& lowBeta() const;
+            const scalarField& lowEa() const;
+            const scalarField& lowLnA() const;
+            const scalarField& lowSignA() const;
+            const scalarField& lowTa() const;
+            const scalarField& troeAlpha() const;
+            const scalarField& troeT3() const;
+            const scalarField& troeT1() const;
+            const scalarField& troeT2() const;
+            const scalarField& sriA() const;
+            const scalarField& sriB() const;
+            const scalarField& sriC() const;
+            const scalarField& sriD() const;
+            const scalarField& sriE() const;
+
+            //- Return the sparse Jacobian structure and the addressing
+            const SparseMatrix& jacobianPattern() const;
+
+            //- Return the non-zero columns of each row of d(omega)/d(c)
+            const List<List<int>>& jacobianStructure() const;
+            const List<int>& jacobianAddr() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryMechanism_hpp included
+
+// ************************************************************************* //
@@ -0,0 +1,371 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryQSSA.hpp"
+#include <algorithm>
+#include <limits>
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryQSSA::ChemistryQSSA
+(
+    const ChemistryCalc& chemistry,
+    const wordList& qssSpecies,
+    const scalar tolerance,
+    const int maxIter
+)
+:
+    chemistry_(chemistry),
+    tolerance_(tolerance),
+    maxIter_(maxIter)
+{
+    const wordList& species = chemistry_.species();
+
+    List<int> ids;
+
+    forAll(qssSpecies, qss)
+    {
+        const auto it = std::find(species.begin(), species.end(), qss);
+
+        if (it == species.end())
+        {
+            ErrorMsg
+            (
+                "    QSS species " + qss + " is not available in the "
+                "chemistry",
+                __FILE__,
+                __LINE__
+            );
+        }
+
+        ids.push_back(it - species.begin());
+    }
+
+    setQSS(ids);
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryQSSA::~ChemistryQSSA()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryQSSA::lifetimes
+(
+    const scalar T,
+    const scalarField& c,
+    scalarField& tau
+) const
+{
+    const int nS = chemistry_.mechanism().nSpecies();
+
+    scalarField k;
+    scalarField K;
+    scalarField conM;
+
+    chemistry_.kf(T, c, k);
+    chemistry_.keq(T, K);
+    chemistry_.M(c, conM);
+
+    tau.resize(nS);
+
+    for (int s = 0; s < nS; ++s)
+    {
+        scalar P{0};
+        scalar D{0};
+
+        productionDestruction(s, k, K, conM, c, P, D);
+
+        tau[s] = D > 0 ? 1 / D : std::numeric_limits<scalar>::max();
+    }
+}
+
+
+void TKC::ChemistryQSSA::select
+(
+    const scalar T,
+    const scalarField& c,
+    const scalar tauMax,
+    const wordList& keep
+)
+{
+    const wordList& species = chemistry_.species();
+
+    scalarField tau;
+
+    lifetimes(T, c, tau);
+
+    List<int> ids;
+
+    forEach(tau, s)
+    {
+        const bool kept =
+            std::find(keep.begin(), keep.end(), species[s]) != keep.end();
+
+        if (tau[s] < tauMax && !kept)
+        {
+            ids.push_back(s);
+        }
+    }
+
+    setQSS(ids);
+}
+
+
+int TKC::ChemistryQSSA::solve
+(
+    const scalar T,
+    scalarField& c
+) const
+{
+    if (qss_.empty())
+    {
+        return 0;
+    }
+
+    scalarField k;
+    scalarField K;
+    scalarField conM;
+
+    chemistry_.keq(T, K);
+
+    int iter{0};
+
+    while (iter < maxIter_)
+    {
+        ++iter;
+
+        //- [M] and the fall off rates depend on the QSS species as well
+        chemistry_.kf(T, c, k);
+        chemistry_.M(c, conM);
+
+        scalar change{0};
+
+        //- Gauss-Seidel, updated values are used immediately
+        forAll(qss_, s)
+        {
+            scalar P{0};
+            scalar D{0};
+
+            productionDestruction(s, k, K, conM, c, P, D);
+
+            const scalar cNew = D > 0 ? P / D : c[s];
+
+            if (cNew > 0)
+            {
+                change = max(change, scalar(fabs(cNew - c[s]) / cNew));
+            }
+
+            c[s] = cNew;
+        }
+
+        if (change < tolerance_)
+        {
+            break;
+        }
+    }
+
+    return iter;
+}
+
+
+void TKC::ChemistryQSSA::omega
+(
+    const scalar T,
+    scalarField& c,
+    scalarField& omega
+) const
+{
+    solve(T, c);
+
+    chemistry_.omega(T, c, omega);
+
+    //- The QSS species are in steady state
+    forAll(qss_, s)
+    {
+        omega[s] = 0;
+    }
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::ChemistryQSSA::setQSS(const List<int>& ids)
+{
+    const int nS = chemistry_.mechanism().nSpecies();
+
+    List<int> isQSS(nS, 0);
+
+    forAll(ids, s)
+    {
+        isQSS[s] = 1;
+    }
+
+    qss_.clear();
+    active_.clear();
+
+    for (int s = 0; s < nS; ++s)
+    {
+        if (isQSS[s])
+        {
+            qss_.push_back(s);
+        }
+        else
+        {
+            active_.push_back(s);
+        }
+    }
+}
+
+
+void TKC::ChemistryQSSA::productionDestruction
+(
+    const int s,
+    const scalarField& k,
+    const scalarField& K,
+    const scalarField& conM,
+    const scalarField& c,
+    scalar& P,
+    scalar& D
+) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const List<int>& rStart = mech.reactantStart();
+    const List<int>& rID = mech.reactantID();
+    const List<int>& rNu = mech.reactantNu();
+    const List<int>& pStart = mech.productStart();
+    const List<int>& pID = mech.productID();
+    const List<int>& pNu = mech.productNu();
+    const List<int>& start = mech.speciesReacStart();
+    const List<int>& reacID = mech.speciesReacID();
+
+    P = 0;
+    D = 0;
+
+    //- Concentration product of one side without one power of species s
+    //  (nu is the stochiometric factor of s on that side)
+    auto product = [&]
+    (
+        const List<int>& sideStart,
+        const List<int>& sideID,
+        const List<int>& sideNu,
+        const int r,
+        int& nu
+    )
+    {
+        scalar prod{1};
+
+        nu = 0;
+
+        for (int i = sideStart[r]; i < sideStart[r+1]; ++i)
+        {
+            if (sideID[i] == s)
+            {
+                nu = sideNu[i];
+                prod *= integerPow(c[s], nu - 1);
+            }
+            else
+            {
+                prod *= integerPow(c[sideID[i]], sideNu[i]);
+            }
+        }
+
+        return prod;
+    };
+
+    for (int j = start[s]; j < start[s+1]; ++j)
+    {
+        const int r = reacID[j];
+
+        scalar kfr = mech.forward(r) ? k[r] : scalar(0);
+        scalar kbr = mech.backward(r) ? k[r] / K[r] : scalar(0);
+
+        //- Third body reaction without fall off, [M] acts as a reactant
+        if (mech.type(r) == ChemistryMechanism::thirdBody)
+        {
+            const scalar M = conM[mech.thirdBodyIndex()[r]];
+
+            kfr *= M;
+            kbr *= M;
+        }
+
+        int nuR{0};
+        int nuP{0};
+
+        const scalar educ = product(rStart, rID, rNu, r, nuR);
+        const scalar prod = product(pStart, pID, pNu, r, nuP);
+
+        //- Full products (incl. species s)
+        const scalar educFull = nuR ? educ * c[s] : educ;
+        const scalar prodFull = nuP ? prod * c[s] : prod;
+
+        //- Forward: consumes nuR and produces nuP, backward vice versa
+        P += nuP * kfr * educFull + nuR * kbr * prodFull;
+        D += nuR * kfr * educ + nuP * kbr * prod;
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+TKC::wordList TKC::ChemistryQSSA::qssSpecies() const
+{
+    const wordList& species = chemistry_.species();
+
+    wordList qss;
+
+    forAll(qss_, s)
+    {
+        qss.push_back(species[s]);
+    }
+
+    return qss;
+}
+
+
+const TKC::List<int>& TKC::ChemistryQSSA::qss() const
+{
+    return qss_;
+}
+
+
+const TKC::List<int>& TKC::ChemistryQSSA::active() const
+{
+    return active_;
+}
+
+
+TKC::scalar TKC::ChemistryQSSA::tolerance() const
+{
+    return tolerance_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,170 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryQSSA
+
+Description
+    Quasi-steady-state approximation (QSSA) for short living (radical)
+    species. The concentrations of the QSS species are not integrated but
+    calculated algebraically out of the remaining species:
+
+        omega_s = P_s - D_s c_s = 0   ->   c_s = P_s / D_s
+
+    with the production P_s and the destruction rate D_s (consumption
+    divided by c_s) of species s. Coupled QSS species (and species with
+    a stochiometric factor > 1) are solved by Gauss-Seidel iterations.
+    The forward rates and [M] are updated in each sweep as they depend on
+    the QSS concentrations as well.
+
+    The QSS species are given by the user or selected by the chemical
+    lifetime tau_s = 1/D_s of a representative state (select()). Their
+    source terms are zero, hence they can be removed from the ODE system.
+
+SourceFiles
+    chemistryQSSA.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryQSSA_hpp
+#define ChemistryQSSA_hpp
+
+#include "chemistryCalc.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                        Class ChemistryQSSA Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryQSSA
+{
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Species IDs of the QSS species
+            List<int> qss_;
+
+            //- Species IDs of the integrated (non QSS) species
+            List<int> active_;
+
+            //- Relative tolerance of the Gauss-Seidel iterations
+            scalar tolerance_;
+
+            //- Maximum number of Gauss-Seidel iterations
+            int maxIter_;
+
+
+        // Private Member Functions
+
+            //- Set the QSS species and the integrated species
+            void setQSS(const List<int>&);
+
+            //- Calculate the production P and destruction rate D (per
+            //  concentration) of species s for the forward rates k, the
+            //  equilibrium constants K and [M] of the third body rows
+            void productionDestruction
+            (
+                const int,
+                const scalarField&,
+                const scalarField&,
+                const scalarField&,
+                const scalarField&,
+                scalar&,
+                scalar&
+            ) const;
+
+
+    public:
+
+        //- Constructor with the QSS species
+        ChemistryQSSA
+        (
+            const ChemistryCalc&,
+            const wordList&,
+            const scalar tolerance = 1e-10,
+            const int maxIter = 100
+        );
+
+        //- Destructor
+        ~ChemistryQSSA();
+
+
+        // Member Functions
+
+            //- Calculate the chemical lifetime 1/D_s of all species for
+            //  the state (T, c ordered by species ID) [s]
+            void lifetimes(const scalar, const scalarField&, scalarField&)
+                const;
+
+            //- Select all species with a lifetime < tauMax at the state
+            //  (T, c) as QSS species (species given in keep are excluded)
+            void select
+            (
+                const scalar,
+                const scalarField&,
+                const scalar,
+                const wordList& keep = wordList()
+            );
+
+            //- Calculate the concentrations of the QSS species in c out of
+            //  the remaining species; returns the number of iterations
+            int solve(const scalar, scalarField&) const;
+
+            //- Calculate the source term of all species with the QSS
+            //  concentrations updated in c (omega of QSS species is 0)
+            void omega(const scalar, scalarField&, scalarField&) const;
+
+
+        // Return Functions
+
+            //- Return the QSS species
+            wordList qssSpecies() const;
+
+            //- Return the species IDs of the QSS species
+            const List<int>& qss() const;
+
+            //- Return the species IDs of the integrated species
+            const List<int>& active() const;
+
+            //- Return the relative tolerance of the Gauss-Seidel iterations
+            scalar tolerance() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryQSSA_hpp included
+
+// ************************************************************************* //
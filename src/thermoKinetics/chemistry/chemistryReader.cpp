@@ -347,13 +347,21 @@ void TKC::ChemistryReader::readReactionBlock
                     std::size_t foundLOW;
                     std::size_t foundSRI;
                     std::size_t foundTROE;
+                    std::size_t foundPLOG;
 
                     foundLOW = fileContent[line].find("LOW");
                     foundSRI = fileContent[line].find("SRI");
                     foundTROE = fileContent[line].find("TROE");
+                    foundPLOG = fileContent[line].find("PLOG");
 
+                    //- PLOG parameters (one line per pressure)
+                    if (foundPLOG != std::string::npos)
+                    {
+                        data.PLOG(true);
+                        PLOGCoeffs(fileContent[line], line, data);
+                    }
                     //- LOW parameters
-                    if (foundLOW != std::string::npos)
+                    else if (foundLOW != std::string::npos)
                     {
                         data.LOW(true);
                         LOWCoeffs(fileContent[line], line, data);
@@ -692,7 +700,43 @@ void TKC::ChemistryReader::SRICoeffs
     forAll(coeffs, i)
     {
          data.SRICoeffs(stod(i), c);
+         c++;
+    }
+}
+
+
+void TKC::ChemistryReader::PLOGCoeffs
+(
+    const string coeffStr,
+    const unsigned int lineNo,
+    ChemistryData& data
+)
+{
+    //- STEP 1: get data inbetween '/'
+    stringList coeffs = extractData(coeffStr);
+
+    //- STEP 2: check if 4 values are available (p, A, beta, Ea)
+    if (coeffs.size() != 4)
+    {
+        ErrorMsg
+        (
+            "More or less than four PLOG coeffs found.\n    "
+            "PLOG coeffs: " + std::to_string(coeffs.size()) +
+            " found in line " + std::to_string(lineNo) + ".\n    "
+            "Problem occur in file " + file_,
+            __FILE__,
+            __LINE__
+        );
     }
+
+    //- STEP 3: update
+    data.PLOGCoeffs
+    (
+        stod(coeffs[0]),
+        stod(coeffs[1]),
+        stod(coeffs[2]),
+        stod(coeffs[3])
+    );
 }
 
 
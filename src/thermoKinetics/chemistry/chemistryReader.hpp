@@ -134,6 +134,9 @@ class ChemistryReader
             //- Manipulate SRI coeffs
             void SRICoeffs(const string, const unsigned int, ChemistryData&);
 
+            //- Manipulate PLOG coeffs (one pressure per line)
+            void PLOGCoeffs(const string, const unsigned int, ChemistryData&);
+
             //- Manipulate ENHANCE factors
             void enhanceFactors(const string, ChemistryData&);
 
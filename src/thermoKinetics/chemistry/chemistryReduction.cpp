@@ -0,0 +1,669 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryReduction.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <queue>
+#include <sstream>
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryReduction::ChemistryReduction
+(
+    const ChemistryCalc& chemistry,
+    const wordList& targets,
+    const scalar threshold,
+    const int method
+)
+:
+    chemistry_(chemistry),
+    threshold_(threshold),
+    method_(method)
+{
+    const wordList& species = chemistry_.species();
+
+    forAll(targets, target)
+    {
+        const auto it = std::find(species.begin(), species.end(), target);
+
+        if (it == species.end())
+        {
+            ErrorMsg
+            (
+                "    Target species " + target + " of the reduction is not "
+                "available in the chemistry",
+                __FILE__,
+                __LINE__
+            );
+        }
+
+        targets_.push_back(it - species.begin());
+    }
+
+    importance_.assign(species.size(), 0);
+
+    buildReactionSpecies();
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryReduction::~ChemistryReduction()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryReduction::importance
+(
+    const scalar T,
+    const scalarField& c,
+    scalarField& R
+) const
+{
+    //- Net rates of progress of the state
+    scalarField q;
+
+    chemistry_.rateOfProgress(T, c, q);
+
+    importance(q, R);
+}
+
+
+void TKC::ChemistryReduction::importance
+(
+    const scalarField& q,
+    scalarField& R
+) const
+{
+    const int nS = chemistry_.mechanism().nSpecies();
+
+    //- Graph of the direct interaction coefficients
+    List<int> start;
+    List<int> id;
+    scalarField rAB;
+
+    interactions(q, start, id, rAB);
+
+    R.assign(nS, 0);
+
+    forAll(targets_, target)
+    {
+        scalarField best(nS, 0);
+
+        best[target] = 1;
+
+        if (method_ == DRG)
+        {
+            //- Species reachable with r_AB >= threshold
+            List<int> stack{target};
+
+            while (!stack.empty())
+            {
+                const int A = stack.back();
+                stack.pop_back();
+
+                for (int i = start[A]; i < start[A+1]; ++i)
+                {
+                    if (rAB[i] >= threshold_ && best[id[i]] == 0)
+                    {
+                        best[id[i]] = 1;
+                        stack.push_back(id[i]);
+                    }
+                }
+            }
+        }
+        else
+        {
+            //- Maximum path product (Dijkstra with products <= 1), paths
+            //  below the threshold are not followed
+            std::priority_queue<std::pair<scalar, int>> queue;
+
+            queue.push({1, target});
+
+            while (!queue.empty())
+            {
+                const scalar value = queue.top().first;
+                const int A = queue.top().second;
+                queue.pop();
+
+                if (value < best[A])
+                {
+                    continue;
+                }
+
+                for (int i = start[A]; i < start[A+1]; ++i)
+                {
+                    const scalar path = value * rAB[i];
+
+                    if (path >= threshold_ && path > best[id[i]])
+                    {
+                        best[id[i]] = path;
+                        queue.push({path, id[i]});
+                    }
+                }
+            }
+        }
+
+        for (int s = 0; s < nS; ++s)
+        {
+            R[s] = max(R[s], best[s]);
+        }
+    }
+}
+
+
+void TKC::ChemistryReduction::addState
+(
+    const scalar T,
+    const scalarField& c
+)
+{
+    scalarField R;
+
+    importance(T, c, R);
+
+    forEach(R, s)
+    {
+        importance_[s] = max(importance_[s], R[s]);
+    }
+
+    ++nStates_;
+}
+
+
+void TKC::ChemistryReduction::addState
+(
+    const scalar T,
+    const map<word, scalar>& c
+)
+{
+    addState(T, chemistry_.mechanism().concentrations(c));
+}
+
+
+TKC::wordList TKC::ChemistryReduction::retainedSpecies() const
+{
+    const wordList& species = chemistry_.species();
+
+    wordList retained;
+
+    forEach(species, s)
+    {
+        if (isKept(importance_, s))
+        {
+            retained.push_back(species[s]);
+        }
+    }
+
+    return retained;
+}
+
+
+TKC::List<int> TKC::ChemistryReduction::retainedReactions() const
+{
+    List<int> retained;
+
+    keptReactions(importance_, retained);
+
+    return retained;
+}
+
+
+void TKC::ChemistryReduction::activeSet
+(
+    const scalarField& q,
+    List<int>& species,
+    List<int>& reactions
+) const
+{
+    scalarField R;
+
+    importance(q, R);
+
+    species.clear();
+
+    forEach(R, s)
+    {
+        if (isKept(R, s))
+        {
+            species.push_back(s);
+        }
+    }
+
+    keptReactions(R, reactions);
+}
+
+
+void TKC::ChemistryReduction::write(const string fileName) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const wordList species = retainedSpecies();
+    const List<int> reactions = retainedReactions();
+
+    Info<< " c-o Write the skeletal mechanism ("
+        << (method_ == DRG ? "DRG" : "DRGEP") << ", " << nStates_
+        << " states)\n"
+        << "     >> Species: " << species.size() << " of "
+        << mech.nSpecies() << "\n"
+        << "     >> Reactions: " << reactions.size() << " of "
+        << mech.nReac() << "\n"
+        << "     >> " << fileName << "\n\n"
+        << " c-o Kept species\n";
+
+    const wordList& allSpecies = chemistry_.species();
+
+    forEach(allSpecies, s)
+    {
+        if (!isKept(importance_, s))
+        {
+            continue;
+        }
+
+        std::ostringstream reason;
+
+        if (std::find(targets_.begin(), targets_.end(), s) != targets_.end())
+        {
+            reason << "target";
+        }
+        else if (importance_[s] >= threshold_)
+        {
+            reason << "importance " << std::setprecision(3)
+                << importance_[s];
+        }
+        else
+        {
+            reason << (inert_[s] ? "inert" : "")
+                << (inert_[s] && thirdBody_[s] ? ", " : "")
+                << (thirdBody_[s] ? "third body" : "")
+                << " (importance " << std::setprecision(3)
+                << importance_[s] << ")";
+        }
+
+        Info<< "     >> " << std::left << std::setw(12) << allSpecies[s]
+            << std::right << reason.str() << "\n";
+    }
+
+    Info<< endl;
+
+    std::filebuf file;
+
+    if (!file.open(fileName, std::ios::out))
+    {
+        ErrorMsg
+        (
+            "    Could not open the file " + fileName,
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    ostream os(&file);
+
+    os  << std::scientific << std::uppercase << std::setprecision(10);
+
+    //- Elements and species
+    os  << "ELEMENTS\n";
+
+    forAll(chemistry_.elements(), element)
+    {
+        os  << element << " ";
+    }
+
+    os  << "\nEND\nSPECIES\n";
+
+    forEach(species, s)
+    {
+        os  << species[s] << ((s+1) % 8 == 0 ? "\n" : " ");
+    }
+
+    os  << "\nEND\nREACTIONS\n";
+
+    //- Reactions with their auxiliary data
+    forAll(reactions, r)
+    {
+        const scalarList& arr = chemistry_.arrheniusCoeffs(r);
+
+        os  << chemistry_.elementarReaction(r) << "  " << arr[0] << "  "
+            << arr[1] << "  " << arr[2] << "\n";
+
+        if (chemistry_.PLOG(r))
+        {
+            const scalarList& plog = chemistry_.PLOGCoeffs(r);
+
+            for (size_t i = 0; i + 3 < plog.size(); i += 4)
+            {
+                os  << "PLOG/" << plog[i] << " " << plog[i+1] << " "
+                    << plog[i+2] << " " << plog[i+3] << "/\n";
+            }
+        }
+
+        if (chemistry_.LOW(r))
+        {
+            const scalarList& low = chemistry_.LOWCoeffs(r);
+
+            os  << "LOW/" << low[0] << " " << low[1] << " " << low[2] << "/\n";
+
+            const int f = mech.fallOffIndex()[r];
+
+            if (mech.fallOffType()[f] == ChemistryMechanism::SRI)
+            {
+                const scalarList& sri = chemistry_.SRICoeffs(r);
+
+                os  << "SRI/" << sri[0] << " " << sri[1] << " " << sri[2]
+                    << " " << sri[3] << " " << sri[4] << "/\n";
+            }
+            else if (mech.fallOffType()[f] == ChemistryMechanism::TROE)
+            {
+                const scalarList& troe = chemistry_.TROECoeffs(r);
+
+                //- T** is optional (zero if not given)
+                os  << "TROE/" << troe[0] << " " << troe[1] << " "
+                    << troe[2];
+
+                if (troe[3] != 0)
+                {
+                    os  << " " << troe[3];
+                }
+
+                os  << "/\n";
+            }
+        }
+
+        //- Enhanced efficiencies of the kept species (+M only)
+        const int tb = mech.thirdBodyIndex()[r];
+
+        if (tb != -1 && mech.thirdBodyDefault()[tb] == 1)
+        {
+            string line;
+
+            for
+            (
+                int i = mech.enhancedStart()[tb];
+                i < mech.enhancedStart()[tb+1];
+                ++i
+            )
+            {
+                const int s = mech.enhancedID()[i];
+
+                if (isKept(importance_, s))
+                {
+                    std::ostringstream eff;
+
+                    eff << chemistry_.species()[s] << "/"
+                        << 1 + mech.enhancedDelta()[i] << "/ ";
+
+                    line += eff.str();
+                }
+            }
+
+            if (!line.empty())
+            {
+                os  << line << "\n";
+            }
+        }
+    }
+
+    os  << "END\n";
+
+    file.close();
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::ChemistryReduction::buildReactionSpecies()
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int nR = mech.nReac();
+
+    reacSpeciesStart_.assign(1, 0);
+    reacSpeciesID_.clear();
+
+    inert_.assign(mech.nSpecies(), true);
+    thirdBody_.assign(mech.nSpecies(), false);
+
+    for (int r = 0; r < nR; ++r)
+    {
+        List<int> ids;
+
+        for (int i = mech.reactantStart()[r]; i < mech.reactantStart()[r+1]; ++i)
+        {
+            ids.push_back(mech.reactantID()[i]);
+        }
+
+        for (int i = mech.productStart()[r]; i < mech.productStart()[r+1]; ++i)
+        {
+            ids.push_back(mech.productID()[i]);
+        }
+
+        forAll(ids, s)
+        {
+            inert_[s] = false;
+        }
+
+        //- Enhanced efficiencies and distinct collision partners
+        const int tb = mech.thirdBodyIndex()[r];
+
+        if (tb != -1)
+        {
+            for
+            (
+                int i = mech.enhancedStart()[tb];
+                i < mech.enhancedStart()[tb+1];
+                ++i
+            )
+            {
+                thirdBody_[mech.enhancedID()[i]] = true;
+            }
+        }
+
+        //- Distinct collision partner such as (+AR)
+        if (tb != -1 && mech.thirdBodyDefault()[tb] == 0)
+        {
+            for
+            (
+                int i = mech.enhancedStart()[tb];
+                i < mech.enhancedStart()[tb+1];
+                ++i
+            )
+            {
+                ids.push_back(mech.enhancedID()[i]);
+            }
+        }
+
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+        reacSpeciesID_.insert(reacSpeciesID_.end(), ids.begin(), ids.end());
+        reacSpeciesStart_.push_back(reacSpeciesID_.size());
+    }
+}
+
+
+void TKC::ChemistryReduction::interactions
+(
+    const scalarField& q,
+    List<int>& start,
+    List<int>& id,
+    scalarField& rAB
+) const
+{
+    const ChemistryMechanism& mech = chemistry_.mechanism();
+
+    const int nS = mech.nSpecies();
+
+    const List<int>& netStart = mech.netStart();
+    const List<int>& netID = mech.netID();
+    const List<int>& netNu = mech.netNu();
+    const List<int>& reacStart = mech.speciesReacStart();
+    const List<int>& reacID = mech.speciesReacID();
+
+    start.assign(1, 0);
+    id.clear();
+    rAB.clear();
+
+    //- Numerator of r_AB for the actual species A and the touched B
+    scalarField numerator(nS, 0);
+    List<int> touched;
+
+    for (int A = 0; A < nS; ++A)
+    {
+        scalar production{0};
+        scalar consumption{0};
+        scalar absolute{0};
+
+        for (int j = reacStart[A]; j < reacStart[A+1]; ++j)
+        {
+            const int r = reacID[j];
+
+            //- Net stochiometric factor of A in reaction r
+            int nu{0};
+
+            for (int i = netStart[r]; i < netStart[r+1]; ++i)
+            {
+                if (netID[i] == A)
+                {
+                    nu = netNu[i];
+                    break;
+                }
+            }
+
+            const scalar w = nu * q[r];
+
+            if (w == 0)
+            {
+                continue;
+            }
+
+            production += max(w, scalar(0));
+            consumption += max(-w, scalar(0));
+            absolute += fabs(w);
+
+            //- DRG sums the absolute values, DRGEP the signed values
+            const scalar contribution = method_ == DRG ? fabs(w) : w;
+
+            for
+            (
+                int i = reacSpeciesStart_[r];
+                i < reacSpeciesStart_[r+1];
+                ++i
+            )
+            {
+                const int B = reacSpeciesID_[i];
+
+                if (B != A)
+                {
+                    if (numerator[B] == 0)
+                    {
+                        touched.push_back(B);
+                    }
+
+                    numerator[B] += contribution;
+                }
+            }
+        }
+
+        const scalar denominator =
+            method_ == DRG ? absolute : max(production, consumption);
+
+        forAll(touched, B)
+        {
+            if (denominator > 0 && numerator[B] != 0)
+            {
+                id.push_back(B);
+                rAB.push_back(fabs(numerator[B]) / denominator);
+            }
+
+            numerator[B] = 0;
+        }
+
+        touched.clear();
+        start.push_back(id.size());
+    }
+}
+
+
+bool TKC::ChemistryReduction::isKept
+(
+    const scalarField& R,
+    const int s
+) const
+{
+    return R[s] >= threshold_ || inert_[s] || thirdBody_[s];
+}
+
+
+void TKC::ChemistryReduction::keptReactions
+(
+    const scalarField& R,
+    List<int>& reactions
+) const
+{
+    reactions.clear();
+
+    const int nR = chemistry_.mechanism().nReac();
+
+    for (int r = 0; r < nR; ++r)
+    {
+        bool keep{true};
+
+        for (int i = reacSpeciesStart_[r]; i < reacSpeciesStart_[r+1]; ++i)
+        {
+            if (!isKept(R, reacSpeciesID_[i]))
+            {
+                keep = false;
+                break;
+            }
+        }
+
+        if (keep)
+        {
+            reactions.push_back(r);
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+const TKC::scalarField& TKC::ChemistryReduction::importance() const
+{
+    return importance_;
+}
+
+
+int TKC::ChemistryReduction::nStates() const
+{
+    return nStates_;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,216 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryReduction
+
+Description
+    Skeletal mechanism reduction with the directed relation graph (DRG,
+    Lu and Law 2005) or the DRG with error propagation (DRGEP,
+    Pepiot-Desjardins and Pitsch 2008).
+
+    For each sampled state (T, c) the direct interaction coefficients of
+    species A with species B are built out of the net rates of progress
+    q_r and the net stochiometry nu_A,r (delta_B,r = 1 if B takes part in
+    reaction r, incl. a distinct collision partner):
+
+        DRG:   r_AB = sum_r |nu_A,r q_r delta_B,r| / sum_r |nu_A,r q_r|
+        DRGEP: r_AB = |sum_r nu_A,r q_r delta_B,r| / max(P_A, C_A)
+
+    with the production P_A and consumption C_A of species A. Starting
+    from the target species, DRG keeps all species reachable by edges
+    r_AB >= threshold; DRGEP keeps all species whose maximum path product
+    of r_AB is >= threshold. The importance of a species is the maximum
+    over all states and targets. Inert species (no reactant or product of
+    any reaction, e.g. N2 as bath gas) and third bodies (enhanced
+    efficiency or distinct collision partner) are always kept, as they
+    change [M] and the mixture properties without being reachable in the
+    graph. Reactions are kept if all their species are kept.
+
+    The skeletal mechanism is written in CHEMKIN format (without thermo
+    data) and can be read back by the ChemistryReader.
+
+    Dynamic adaptive chemistry: activeSet() performs the same sweep for a
+    single state out of its rates of progress and returns the locally
+    active species and reactions without touching the accumulated data
+    (reentrant, see ChemistryDriver::activeSets).
+
+SourceFiles
+    chemistryReduction.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryReduction_hpp
+#define ChemistryReduction_hpp
+
+#include "chemistryCalc.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                      Class ChemistryReduction Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryReduction
+{
+    public:
+
+        //- Reduction method
+        enum reductionMethod
+        {
+            DRG,
+            DRGEP
+        };
+
+
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Species IDs of the targets
+            List<int> targets_;
+
+            //- Threshold of the importance
+            scalar threshold_;
+
+            //- Method (DRG or DRGEP)
+            int method_;
+
+            //- Species in reaction r (CSR, unique, incl. collision partner)
+            List<int> reacSpeciesStart_;
+            List<int> reacSpeciesID_;
+
+            //- Species that are always kept: inert species and third bodies
+            List<bool> inert_;
+            List<bool> thirdBody_;
+
+            //- Maximum importance of each species over all states
+            scalarField importance_;
+
+            //- Number of sampled states
+            int nStates_{0};
+
+
+        // Private Member Functions
+
+            //- Build the species of each reaction out of the mechanism and
+            //  mark the inert species and the third bodies
+            void buildReactionSpecies();
+
+            //- Return true if species s is kept for the importance R
+            bool isKept(const scalarField&, const int) const;
+
+            //- Calculate the direct interaction coefficients r_AB for the
+            //  rates of progress q (CSR, rows = species A)
+            void interactions
+            (
+                const scalarField&,
+                List<int>&,
+                List<int>&,
+                scalarField&
+            ) const;
+
+            //- Collect the reactions of which all species have an
+            //  importance >= threshold
+            void keptReactions(const scalarField&, List<int>&) const;
+
+
+    public:
+
+        //- Constructor with the target species, the threshold and method
+        ChemistryReduction
+        (
+            const ChemistryCalc&,
+            const wordList&,
+            const scalar,
+            const int method = DRGEP
+        );
+
+        //- Destructor
+        ~ChemistryReduction();
+
+
+        // Member Functions
+
+            //- Calculate the importance of all species for one state
+            //  (T, c ordered by species ID); for DRG the importance is 1
+            //  for reachable species and 0 otherwise
+            void importance(const scalar, const scalarField&, scalarField&)
+                const;
+
+            //- Calculate the importance of all species for one state out
+            //  of the rates of progress q of all reactions (reentrant)
+            void importance(const scalarField&, scalarField&) const;
+
+            //- Calculate the active species and reactions of one state
+            //  out of the rates of progress q of all reactions (reentrant)
+            void activeSet
+            (
+                const scalarField&,
+                List<int>&,
+                List<int>&
+            ) const;
+
+            //- Add a sampled state (T, c ordered by species ID)
+            void addState(const scalar, const scalarField&);
+
+            //- Add a sampled state (T, c as map)
+            void addState(const scalar, const map<word, scalar>&);
+
+            //- Return the species that are kept (all targets, inert
+            //  species and third bodies included)
+            wordList retainedSpecies() const;
+
+            //- Return the reactions that are kept
+            List<int> retainedReactions() const;
+
+            //- Write the skeletal mechanism in CHEMKIN format, the kept
+            //  species are printed with the reason
+            void write(const string) const;
+
+
+        // Return Functions
+
+            //- Return the maximum importance of all species
+            const scalarField& importance() const;
+
+            //- Return the number of sampled states
+            int nStates() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryReduction_hpp included
+
+// ************************************************************************* //
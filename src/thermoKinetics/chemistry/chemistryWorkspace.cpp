@@ -0,0 +1,81 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "chemistryWorkspace.hpp"
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ChemistryWorkspace::ChemistryWorkspace()
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ChemistryWorkspace::~ChemistryWorkspace()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ChemistryWorkspace::resize
+(
+    const int nSpecies,
+    const int N,
+    const int nFallOff
+)
+{
+    //- std::vector keeps its capacity, hence this is cheap for blocks of
+    //  the same (or smaller) size
+    T.resize(N);
+    lnT.resize(N);
+    rT.resize(N);
+    lnP0RT.resize(N);
+
+    gRT.resize(nSpecies);
+
+    forAll(gRT, g)
+    {
+        g.resize(N);
+    }
+
+    kf.resize(N);
+    kb.resize(N);
+    cTotal.resize(N);
+    conM.resize(N);
+    educ.resize(N);
+    prod.resize(N);
+
+    kFallOff.resize(nFallOff);
+    conMFallOff.resize(nFallOff);
+
+    for (int f = 0; f < nFallOff; ++f)
+    {
+        kFallOff[f].resize(N);
+        conMFallOff[f].resize(N);
+    }
+}
+
+
+// ************************************************************************* //
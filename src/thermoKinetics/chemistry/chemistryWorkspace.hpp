@@ -0,0 +1,113 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ChemistryWorkspace
+
+Description
+    Scratch storage of the batched (multi-state) chemistry kernels. All
+    fields hold one value per state of the actual block. The kernels only
+    write into the workspace and never into ChemistryData, hence each
+    thread that owns its own workspace can evaluate blocks concurrently.
+
+SourceFiles
+    chemistryWorkspace.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ChemistryWorkspace_hpp
+#define ChemistryWorkspace_hpp
+
+#include "definitions.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                      Class ChemistryWorkspace Declaration
+\*---------------------------------------------------------------------------*/
+
+class ChemistryWorkspace
+{
+    public:
+
+        // Public data
+
+            //- Temperature, ln(T) and 1/T of the states
+            scalarField T;
+            scalarField lnT;
+            scalarField rT;
+
+            //- Conversion of Kp into Kc, ln(p0/(RT))
+            scalarField lnP0RT;
+
+            //- g0/(RT) of all species [nSpecies][N]
+            List<scalarField> gRT;
+
+            //- Forward and backward rates of the actual reaction
+            scalarField kf;
+            scalarField kb;
+
+            //- Total concentration and third body concentration [M]
+            scalarField cTotal;
+            scalarField conM;
+
+            //- Concentration products of the actual reaction
+            scalarField educ;
+            scalarField prod;
+
+            //- kinf (replaced by kf) and [M] (replaced by Pr) of all fall
+            //  off reactions [nFallOff][N]
+            List<scalarField> kFallOff;
+            List<scalarField> conMFallOff;
+
+            //- Fall off rows of the evaluated reactions (sorted)
+            List<int> fallOffRows;
+
+
+        //- Constructor
+        ChemistryWorkspace();
+
+        //- Destructor
+        ~ChemistryWorkspace();
+
+
+        // Member Functions
+
+            //- Resize the workspace for nSpecies, N states and nFallOff
+            //  reactions (no reallocation if the size did not grow)
+            void resize(const int, const int, const int nFallOff = 0);
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ChemistryWorkspace_hpp included
+
+// ************************************************************************* //
@@ -0,0 +1,376 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "rateTable.hpp"
+#include "chemistryCalc.hpp"
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::RateTable::RateTable()
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::RateTable::~RateTable()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::RateTable::build
+(
+    const ChemistryCalc& chemistry,
+    const scalar Tmin,
+    const scalar Tmax,
+    const scalar p,
+    const scalar tolerance,
+    const int maxIntervals
+)
+{
+    if (Tmin <= 0 || Tmax <= Tmin)
+    {
+        ErrorMsg
+        (
+            "    The temperature range [" + toStr(Tmin) + ", " + toStr(Tmax)
+          + "] of the rate table is not valid",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    const ChemistryMechanism& mech = chemistry.mechanism();
+
+    nReac_ = mech.nReac();
+    Tmin_ = Tmin;
+    Tmax_ = Tmax;
+    p_ = p;
+    signKf_ = mech.signA();
+
+    //- Double the intervals until the tolerance is reached
+    int n{16};
+
+    for (;;)
+    {
+        fill(chemistry, n);
+        check(chemistry, errorKf_, errorKeq_);
+
+        if (max(errorKf_, errorKeq_) <= tolerance || 2*n > maxIntervals)
+        {
+            break;
+        }
+
+        n *= 2;
+    }
+
+    Info<< " c-o Tabulated kf and Keq for T = [" << Tmin_ << ", " << Tmax_
+        << "] K with " << nIntervals_ << " intervals\n"
+        << "     >> Error bound of ln(kf): " << errorKf_ << "\n"
+        << "     >> Estimated max. error of ln(Keq): " << errorKeq_ << "\n"
+        << endl;
+
+    if (max(errorKf_, errorKeq_) > tolerance)
+    {
+        Warning
+        (
+            "    The tolerance of the rate table is not reached with "
+          + toStr(nIntervals_) + " intervals (see the errors above)",
+            __FILE__,
+            __LINE__
+        );
+    }
+}
+
+
+void TKC::RateTable::clear()
+{
+    nIntervals_ = 0;
+
+    lnKf_.clear();
+    slopeKf_.clear();
+    lnKeq_.clear();
+    slopeKeq_.clear();
+}
+
+
+bool TKC::RateTable::valid(const scalar T) const
+{
+    return nIntervals_ > 0 && T >= Tmin_ && T <= Tmax_;
+}
+
+
+bool TKC::RateTable::valid(const scalar T, const scalar p) const
+{
+    return valid(T) && p == p_;
+}
+
+
+void TKC::RateTable::lnKf(const scalar T, scalarField& lnKf) const
+{
+    interpolate(T, lnKf_, slopeKf_, lnKf);
+}
+
+
+void TKC::RateTable::kf(const scalar T, scalarField& kf) const
+{
+    interpolate(T, lnKf_, slopeKf_, kf);
+
+    const scalar* sign = signKf_.data();
+    scalar* k = kf.data();
+
+    #pragma omp simd
+    for (int r = 0; r < nReac_; ++r)
+    {
+        k[r] = sign[r] * exp(k[r]);
+    }
+}
+
+
+void TKC::RateTable::lnKeq(const scalar T, scalarField& lnKeq) const
+{
+    interpolate(T, lnKeq_, slopeKeq_, lnKeq);
+}
+
+
+void TKC::RateTable::keq(const scalar T, scalarField& keq) const
+{
+    interpolate(T, lnKeq_, slopeKeq_, keq);
+
+    scalar* K = keq.data();
+
+    #pragma omp simd
+    for (int r = 0; r < nReac_; ++r)
+    {
+        K[r] = exp(K[r]);
+    }
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void TKC::RateTable::fill(const ChemistryCalc& chemistry, const int n)
+{
+    nIntervals_ = n;
+    xMin_ = 1 / Tmax_;
+    dx_ = (1/Tmin_ - xMin_) / n;
+
+    lnKf_.resize((n+1)*nReac_);
+    slopeKf_.resize((n+1)*nReac_);
+    lnKeq_.resize((n+1)*nReac_);
+    slopeKeq_.resize((n+1)*nReac_);
+
+    scalarField value;
+    scalarField slope;
+
+    for (int i = 0; i <= n; ++i)
+    {
+        //- Last node exactly at Tmin
+        const scalar T = (i == n) ? Tmin_ : 1/(xMin_ + i*dx_);
+
+        exactKf(chemistry, T, value, slope);
+
+        for (int r = 0; r < nReac_; ++r)
+        {
+            lnKf_[i*nReac_ + r] = value[r];
+            slopeKf_[i*nReac_ + r] = dx_ * slope[r];
+        }
+
+        exactKeq(chemistry, T, value, slope);
+
+        for (int r = 0; r < nReac_; ++r)
+        {
+            lnKeq_[i*nReac_ + r] = value[r];
+            slopeKeq_[i*nReac_ + r] = dx_ * slope[r];
+        }
+    }
+}
+
+
+void TKC::RateTable::check
+(
+    const ChemistryCalc& chemistry,
+    scalar& errorKf,
+    scalar& errorKeq
+) const
+{
+    //- ln(kf) = ln(A) - beta ln(x) - Ta x, d^4/dx^4 = 6 beta/x^4 is
+    //  largest at xMin = 1/Tmax; Hermite remainder dx^4/384 max|f''''|
+    scalar betaMax{0};
+
+    forAll(chemistry.mechanism().beta(), beta)
+    {
+        betaMax = max(betaMax, scalar(fabs(beta)));
+    }
+
+    errorKf = betaMax*integerPow(dx_/xMin_, 4)/64;
+
+    //- ln(Keq) is estimated at the quarter points
+    errorKeq = 0;
+
+    scalarField exact;
+    scalarField slope;
+    scalarField table;
+
+    for (int i = 0; i < nIntervals_; ++i)
+    {
+        for (const scalar t : {0.25, 0.5, 0.75})
+        {
+            const scalar T = 1/(xMin_ + (i + t)*dx_);
+
+            exactKeq(chemistry, T, exact, slope);
+            lnKeq(T, table);
+
+            for (int r = 0; r < nReac_; ++r)
+            {
+                errorKeq = max(errorKeq, scalar(fabs(table[r] - exact[r])));
+            }
+        }
+    }
+}
+
+
+void TKC::RateTable::exactKf
+(
+    const ChemistryCalc& chemistry,
+    const scalar T,
+    scalarField& lnKf,
+    scalarField& dlnKfdx
+) const
+{
+    const ChemistryMechanism& mech = chemistry.mechanism();
+
+    const scalarField& lnA = mech.lnA();
+    const scalarField& beta = mech.beta();
+    const scalarField& Ta = mech.Ta();
+
+    lnKf.resize(nReac_);
+    dlnKfdx.resize(nReac_);
+
+    //- ln(k) = ln(A) - beta*ln(x) - Ta*x with x = 1/T
+    const scalar lnT = log(T);
+
+    for (int r = 0; r < nReac_; ++r)
+    {
+        lnKf[r] = lnA[r] + beta[r]*lnT - Ta[r]/T;
+        dlnKfdx[r] = -beta[r]*T - Ta[r];
+    }
+}
+
+
+void TKC::RateTable::exactKeq
+(
+    const ChemistryCalc& chemistry,
+    const scalar T,
+    scalarField& lnKeq,
+    scalarField& dlnKeqdx
+) const
+{
+    chemistry.lnKeq(T, p_, lnKeq, dlnKeqdx);
+
+    //- d/dx = -T^2 d/dT
+    forAll(dlnKeqdx, d)
+    {
+        d *= -T*T;
+    }
+}
+
+
+void TKC::RateTable::interpolate
+(
+    const scalar T,
+    const scalarField& value,
+    const scalarField& slope,
+    scalarField& result
+) const
+{
+    result.resize(nReac_);
+
+    //- Interval and local coordinate t in [0, 1]
+    const scalar s = (1/T - xMin_) / dx_;
+
+    const int i = max(0, min(int(s), nIntervals_ - 1));
+
+    const scalar t = s - i;
+
+    //- Cubic Hermite basis
+    const scalar h00 = (1 + 2*t)*(1 - t)*(1 - t);
+    const scalar h10 = t*(1 - t)*(1 - t);
+    const scalar h01 = t*t*(3 - 2*t);
+    const scalar h11 = t*t*(t - 1);
+
+    const scalar* v0 = value.data() + i*nReac_;
+    const scalar* v1 = v0 + nReac_;
+    const scalar* d0 = slope.data() + i*nReac_;
+    const scalar* d1 = d0 + nReac_;
+    scalar* y = result.data();
+
+    #pragma omp simd
+    for (int r = 0; r < nReac_; ++r)
+    {
+        y[r] = h00*v0[r] + h10*d0[r] + h01*v1[r] + h11*d1[r];
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::RateTable::nIntervals() const
+{
+    return nIntervals_;
+}
+
+
+TKC::scalar TKC::RateTable::Tmin() const
+{
+    return Tmin_;
+}
+
+
+TKC::scalar TKC::RateTable::Tmax() const
+{
+    return Tmax_;
+}
+
+
+TKC::scalar TKC::RateTable::p() const
+{
+    return p_;
+}
+
+
+TKC::scalar TKC::RateTable::errorKf() const
+{
+    return errorKf_;
+}
+
+
+TKC::scalar TKC::RateTable::errorKeq() const
+{
+    return errorKeq_;
+}
+
+
+// ************************************************************************* //
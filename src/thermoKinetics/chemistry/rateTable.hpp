@@ -0,0 +1,219 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::RateTable
+
+Description
+    Tabulated ln(kf) and ln(Keq) of all reactions on a uniform grid in 1/T.
+    The values and their exact derivatives d/d(1/T) are stored node by
+    node (contiguous over the reactions), the evaluation is a cubic
+    Hermite interpolation, i.e. four multiply-adds per reaction. The grid
+    is refined (doubled) until the interpolation error is below the
+    tolerance:
+
+    + ln(kf) = ln(A) - beta ln(x) - Ta x: the remainder of the Hermite
+      interpolation gives the bound dx^4/384 max|d^4 ln(kf)/dx^4|
+      = dx^4/64 |beta| Tmax^4
+    + ln(Keq): the NASA polynomials switch at their common temperature
+      (no smooth fourth derivative), hence the error is estimated at three
+      points of each interval against the exact values
+
+    kf is the standard arrhenius (high pressure limit for fall off
+    reactions), Keq is only valid for the pressure used for the build.
+    The error is given in ln(k), i.e. it is the relative error of k. At the
+    common temperature of the NASA polynomials the derivative of ln(Keq)
+    jumps, hence the refinement converges slower if Keq dominates.
+
+SourceFiles
+    rateTable.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef RateTable_hpp
+#define RateTable_hpp
+
+#include "definitions.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+class ChemistryCalc;
+
+/*---------------------------------------------------------------------------*\
+                          Class RateTable Declaration
+\*---------------------------------------------------------------------------*/
+
+class RateTable
+{
+    private:
+
+        // Private data
+
+            //- Number of reactions
+            int nReac_{0};
+
+            //- Number of intervals, zero if not built
+            int nIntervals_{0};
+
+            //- Temperature range [K]
+            scalar Tmin_{0};
+            scalar Tmax_{0};
+
+            //- Pressure used for Keq [Pa]
+            scalar p_{0};
+
+            //- Grid in x = 1/T, x_i = xMin_ + i*dx_
+            scalar xMin_{0};
+            scalar dx_{0};
+
+            //- Sign of kf (negative pre-exponential factors, zero if A = 0)
+            scalarField signKf_;
+
+            //- ln(kf) and dx*d(ln(kf))/dx at the nodes [node][reaction]
+            scalarField lnKf_;
+            scalarField slopeKf_;
+
+            //- ln(Keq) and dx*d(ln(Keq))/dx at the nodes [node][reaction]
+            scalarField lnKeq_;
+            scalarField slopeKeq_;
+
+            //- Bound of the interpolation error in ln(kf) and estimated
+            //  maximum interpolation error in ln(Keq)
+            scalar errorKf_{0};
+            scalar errorKeq_{0};
+
+
+        // Private Member Functions
+
+            //- Fill the nodes for n intervals out of the exact values
+            void fill(const ChemistryCalc&, const int);
+
+            //- Return the bound of the error of ln(kf) and the estimated
+            //  maximum error of ln(Keq) (quarter points of all intervals)
+            void check(const ChemistryCalc&, scalar&, scalar&) const;
+
+            //- Exact ln(kf) and d(ln(kf))/dx for temperature T
+            void exactKf
+            (
+                const ChemistryCalc&,
+                const scalar,
+                scalarField&,
+                scalarField&
+            ) const;
+
+            //- Exact ln(Keq) and d(ln(Keq))/dx for temperature T
+            void exactKeq
+            (
+                const ChemistryCalc&,
+                const scalar,
+                scalarField&,
+                scalarField&
+            ) const;
+
+            //- Interpolate the tabulated field for temperature T
+            void interpolate
+            (
+                const scalar,
+                const scalarField&,
+                const scalarField&,
+                scalarField&
+            ) const;
+
+
+    public:
+
+        //- Constructor
+        RateTable();
+
+        //- Destructor
+        ~RateTable();
+
+
+        // Member Functions
+
+            //- Build the table for the chemistry, T range [Tmin, Tmax],
+            //  pressure p, the tolerance of ln(k) and the maximum number
+            //  of intervals
+            void build
+            (
+                const ChemistryCalc&,
+                const scalar,
+                const scalar,
+                const scalar,
+                const scalar,
+                const int maxIntervals = 4096
+            );
+
+            //- Remove the table
+            void clear();
+
+            //- Return true if the table is built and T is in the range
+            bool valid(const scalar) const;
+
+            //- Return true if the table is valid for T and pressure p
+            bool valid(const scalar, const scalar) const;
+
+            //- Interpolate ln(kf) of all reactions
+            void lnKf(const scalar, scalarField&) const;
+
+            //- Interpolate kf of all reactions
+            void kf(const scalar, scalarField&) const;
+
+            //- Interpolate ln(Keq) of all reactions
+            void lnKeq(const scalar, scalarField&) const;
+
+            //- Interpolate Keq of all reactions
+            void keq(const scalar, scalarField&) const;
+
+
+        // Return Functions
+
+            //- Return the number of intervals
+            int nIntervals() const;
+
+            //- Return the temperature range
+            scalar Tmin() const;
+            scalar Tmax() const;
+
+            //- Return the pressure of Keq
+            scalar p() const;
+
+            //- Return the bound of the interpolation error of ln(kf) and
+            //  the estimated maximum interpolation error of ln(Keq)
+            scalar errorKf() const;
+            scalar errorKeq() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // RateTable_hpp included
+
+// ************************************************************************* //
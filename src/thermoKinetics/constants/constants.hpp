@@ -77,6 +77,9 @@ constexpr scalar Rcal = R * jouleToCal;
 //- Universal gas constant [erg/K/mol]
 constexpr scalar Rerg = 8.314459848e7;
 
+//- Universal gas constant [cm^3 Pa/K/mol] for concentrations in [mol/cm^3]
+constexpr scalar RcmPa = R * 1e6;
+
 //- Boltzmann Constant [J/K] = [kg m / s^2 K]
 constexpr scalar kB = 1.3806485279e-23;
 
@@ -104,6 +104,66 @@ void TKC::IdealReactorProperties::interprete(const bool value)
 }
 
 
+void TKC::IdealReactorProperties::odeSolver(const word solver)
+{
+    odeSolver_ = solver;
+}
+
+
+void TKC::IdealReactorProperties::relTol(const scalar value)
+{
+    relTol_ = value;
+}
+
+
+void TKC::IdealReactorProperties::absTol(const scalar value)
+{
+    absTol_ = value;
+}
+
+
+void TKC::IdealReactorProperties::ignitionTemperature(const scalar value)
+{
+    ignitionTemperature_ = value;
+}
+
+
+void TKC::IdealReactorProperties::stopAtIgnition(const bool stop)
+{
+    stopAtIgnition_ = stop;
+}
+
+
+void TKC::IdealReactorProperties::qssSpecies(const wordList& species)
+{
+    qssSpecies_ = species;
+}
+
+
+void TKC::IdealReactorProperties::qssLifetime(const scalar value)
+{
+    qssLifetime_ = value;
+}
+
+
+void TKC::IdealReactorProperties::rateTableTmin(const scalar value)
+{
+    rateTableTmin_ = value;
+}
+
+
+void TKC::IdealReactorProperties::rateTableTmax(const scalar value)
+{
+    rateTableTmax_ = value;
+}
+
+
+void TKC::IdealReactorProperties::rateTableTolerance(const scalar value)
+{
+    rateTableTolerance_ = value;
+}
+
+
 // * * * * * * * * * * * * * * * Other functions * * * * * * * * * * * * * * //
 
 
@@ -410,4 +470,64 @@ const bool TKC::IdealReactorProperties::interprete() const
 }
 
 
+TKC::word TKC::IdealReactorProperties::odeSolver() const
+{
+    return odeSolver_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::relTol() const
+{
+    return relTol_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::absTol() const
+{
+    return absTol_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::ignitionTemperature() const
+{
+    return ignitionTemperature_;
+}
+
+
+bool TKC::IdealReactorProperties::stopAtIgnition() const
+{
+    return stopAtIgnition_;
+}
+
+
+const TKC::wordList& TKC::IdealReactorProperties::qssSpecies() const
+{
+    return qssSpecies_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::qssLifetime() const
+{
+    return qssLifetime_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::rateTableTmin() const
+{
+    return rateTableTmin_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::rateTableTmax() const
+{
+    return rateTableTmax_;
+}
+
+
+TKC::scalar TKC::IdealReactorProperties::rateTableTolerance() const
+{
+    return rateTableTolerance_;
+}
+
+
 // ************************************************************************* //
@@ -77,6 +77,48 @@ class IdealReactorProperties
             word fileTransport_;
 
 
+        // ODE solver settings
+
+            //- Name of the stiff ODE solver
+            word odeSolver_{"BDF"};
+
+            //- Relative tolerance of the integration
+            scalar relTol_{1e-6};
+
+            //- Absolute tolerance of the integration
+            scalar absTol_{1e-12};
+
+
+        // Ignition
+
+            //- Temperature that defines the ignition (none if zero) [K]
+            scalar ignitionTemperature_{0};
+
+            //- Stop the calculation at the ignition
+            bool stopAtIgnition_{false};
+
+
+        // QSSA
+
+            //- Species in quasi steady state
+            wordList qssSpecies_;
+
+            //- Select the species with a lifetime below this value at the
+            //  initial state as QSS species (none if zero) [s]
+            scalar qssLifetime_{0};
+
+
+        // Rate table
+
+            //- Temperature range of the tabulated kf and Keq (none if
+            //  Tmax is zero) [K]
+            scalar rateTableTmin_{0};
+            scalar rateTableTmax_{0};
+
+            //- Tolerance of ln(k) of the rate table
+            scalar rateTableTolerance_{1e-6};
+
+
         // Boolean
 
             //- Input either mole or mass fraction or concentration
@@ -121,6 +163,34 @@ class IdealReactorProperties
             //- Insert interprete boolean
             void interprete(const bool);
 
+            //- Insert the name of the ODE solver
+            void odeSolver(const word);
+
+            //- Insert the relative tolerance of the ODE solver
+            void relTol(const scalar);
+
+            //- Insert the absolute tolerance of the ODE solver
+            void absTol(const scalar);
+
+            //- Insert the ignition temperature [K]
+            void ignitionTemperature(const scalar);
+
+            //- Insert if the calculation stops at the ignition
+            void stopAtIgnition(const bool);
+
+            //- Insert the QSS species
+            void qssSpecies(const wordList&);
+
+            //- Insert the lifetime that selects the QSS species [s]
+            void qssLifetime(const scalar);
+
+            //- Insert the temperature range of the rate table [K]
+            void rateTableTmin(const scalar);
+            void rateTableTmax(const scalar);
+
+            //- Insert the tolerance of the rate table
+            void rateTableTolerance(const scalar);
+
 
         // Return Functions
 
@@ -148,6 +218,34 @@ class IdealReactorProperties
             //- Return if the data should be interpreted
             const bool interprete() const;
 
+            //- Return the name of the ODE solver
+            word odeSolver() const;
+
+            //- Return the relative tolerance of the ODE solver
+            scalar relTol() const;
+
+            //- Return the absolute tolerance of the ODE solver
+            scalar absTol() const;
+
+            //- Return the ignition temperature [K]
+            scalar ignitionTemperature() const;
+
+            //- Return true if the calculation stops at the ignition
+            bool stopAtIgnition() const;
+
+            //- Return the QSS species
+            const wordList& qssSpecies() const;
+
+            //- Return the lifetime that selects the QSS species [s]
+            scalar qssLifetime() const;
+
+            //- Return the temperature range of the rate table [K]
+            scalar rateTableTmin() const;
+            scalar rateTableTmax() const;
+
+            //- Return the tolerance of the rate table
+            scalar rateTableTolerance() const;
+
 };
 
 
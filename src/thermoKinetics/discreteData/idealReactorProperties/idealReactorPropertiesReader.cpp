@@ -134,6 +134,49 @@ void TKC::IdealReactorPropertiesReader::read(IdealReactorProperties& data)
             {
                 data.transport(tmp[1]);
             }
+            else if (tmp[0] == "odeSolver")
+            {
+                data.odeSolver(tmp[1]);
+            }
+            else if (tmp[0] == "relTol")
+            {
+                data.relTol(stod(tmp[1]));
+            }
+            else if (tmp[0] == "absTol")
+            {
+                data.absTol(stod(tmp[1]));
+            }
+            else if (tmp[0] == "ignitionTemperature")
+            {
+                data.ignitionTemperature(stod(tmp[1]));
+            }
+            else if (tmp[0] == "stopAtIgnition")
+            {
+                if (tmp[1] == "true" || tmp[1] == "yes")
+                {
+                    data.stopAtIgnition(true);
+                }
+            }
+            else if (tmp[0] == "rateTable")
+            {
+                rateTableData(fileContent, line, data);
+            }
+            else if (tmp[0] == "qssSpecies")
+            {
+                //- All species of the line
+                wordList species;
+
+                for (unsigned int i = 1; i < tmp.size(); ++i)
+                {
+                    species.push_back(tmp[i]);
+                }
+
+                data.qssSpecies(species);
+            }
+            else if (tmp[0] == "qssLifetime")
+            {
+                data.qssLifetime(stod(tmp[1]));
+            }
             else if (tmp[0] == "interprete")
             {
                 if (tmp[1] == "true" || tmp[1] == "yes")
@@ -216,49 +259,34 @@ void TKC::IdealReactorPropertiesReader::initialSpeciesData
         //- If line is not empty and no comment, proceed
         if (!tmp.empty())
         {
-            //- If more elements in one line
-            if (tmp.size() > 2)
+            //- Pairs of species and value, more pairs per line allowed
+            if (tmp.size() % 2)
+            {
+                ErrorMsg
+                (
+                    "Problem in the initial composition, a species without "
+                    "value is given (" + file_ + ")",
+                    __FILE__,
+                    __LINE__
+                );
+            }
+
+            for (unsigned int i = 0; i < tmp.size(); i += 2)
             {
-                //- The modulus has to be equal to zero
-                if (!tmp.size() % 2)
+                const word species = tmp[i];
+                const scalar value = stod(tmp[i+1]);
+
+                if (data.inputMode() == "mole")
                 {
-                    ErrorMsg
-                    (
-                        "Problem in dictionary ",
-                        __FILE__,
-                        __LINE__
-                    );
+                    data.X(species, value);
                 }
-
-                forEach(tmp, element)
+                else if (data.inputMode() == "mass")
                 {
-                    unsigned int modul = element%2;
-
-                    Info<< "element: " << element << endl;
-
-                    /*
-                    if (modul)
-                    {
-                        data.insertCompositionOxidizerMass
-                        (
-                            tmp[element],
-                            stod(tmp[element+1])
-                        );
-                    }
-                    */
+                    data.Y(species, value);
                 }
-            }
-            else
-            {
-                if (tmp[1].empty())
+                else
                 {
-                    ErrorMsg
-                    (
-                        "Problem in dictionary massFractionOxidizer "
-                        "(" + file_ + ")",
-                        __FILE__,
-                        __LINE__
-                    );
+                    data.C(species, value);
                 }
             }
         }
@@ -266,4 +294,61 @@ void TKC::IdealReactorPropertiesReader::initialSpeciesData
 }
 
 
+void TKC::IdealReactorPropertiesReader::rateTableData
+(
+    const stringList& fileContent,
+    unsigned int line,
+    IdealReactorProperties& data
+)
+{
+    int dictBegin{-1};
+    unsigned int dictEnd{0};
+
+    findKeyword(dictBegin, dictEnd, fileContent, line);
+
+    line = dictBegin+1;
+
+    for(; line < dictEnd; line++)
+    {
+        //- Line content
+        string lineContent = fileContent[line];
+
+        //- Remove any comments '!'
+        removeComment(lineContent);
+
+        //- Split string; delimiter ' '
+        stringList tmp = splitStrAtWS(lineContent);
+
+        //- Pairs of keyword and value only
+        if (tmp.size() < 2)
+        {
+            continue;
+        }
+
+        if (tmp[0] == "Tmin")
+        {
+            data.rateTableTmin(stod(tmp[1]));
+        }
+        else if (tmp[0] == "Tmax")
+        {
+            data.rateTableTmax(stod(tmp[1]));
+        }
+        else if (tmp[0] == "tolerance")
+        {
+            data.rateTableTolerance(stod(tmp[1]));
+        }
+    }
+
+    if (data.rateTableTmax() <= data.rateTableTmin())
+    {
+        ErrorMsg
+        (
+            "Tmin and Tmax of the rate table are not valid (" + file_ + ")",
+            __FILE__,
+            __LINE__
+        );
+    }
+}
+
+
 // ************************************************************************* //
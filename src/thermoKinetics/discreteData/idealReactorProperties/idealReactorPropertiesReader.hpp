@@ -96,6 +96,14 @@ class IdealReactorPropertiesReader
                 unsigned int,
                 IdealReactorProperties&
             );
+
+            //- Reading rate table dictionary (Tmin, Tmax, tolerance)
+            void rateTableData
+            (
+                const stringList&,
+                unsigned int,
+                IdealReactorProperties&
+            );
 };
 
 // * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
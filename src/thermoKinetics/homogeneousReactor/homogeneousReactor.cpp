@@ -0,0 +1,397 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "homogeneousReactor.hpp"
+#include "constants.hpp"
+#include "thermo.hpp"
+#include <math.h>
+#include <algorithm>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::HomogeneousReactor::HomogeneousReactor
+(
+    const ChemistryCalc& chemistry,
+    const scalar p,
+    const bool exact
+)
+:
+    chemistry_(chemistry),
+    nSpecies_(chemistry.mechanism().nSpecies()),
+    p_(p),
+    W_(nSpecies_),
+    exact_(exact),
+    c_(nSpecies_),
+    omega_(nSpecies_),
+    dwdT_(nSpecies_),
+    dwdcC_(nSpecies_),
+    hSum_(nSpecies_),
+    dwdc_(chemistry.mechanism().jacobianPattern())
+{
+    const int n = nSpecies_;
+
+    const wordList& species = chemistry_.species();
+
+    const Thermo thermo = chemistry_.thermo();
+
+    forEach(species, i)
+    {
+        W_[i] = thermo.MW(species[i]);
+    }
+
+    //- Chemistry structure extended by the dense temperature row/column
+    const List<List<int>>& structure =
+        chemistry_.mechanism().jacobianStructure();
+
+    List<List<int>> pattern(n+1);
+
+    for (int i = 0; i < n; ++i)
+    {
+        pattern[i] = structure[i];
+        pattern[i].push_back(n);
+
+        if (exact_)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                pattern[i].push_back(j);
+            }
+        }
+    }
+
+    for (int j = 0; j <= n; ++j)
+    {
+        pattern[n].push_back(j);
+    }
+
+    structure_ = SparseMatrix(pattern);
+
+    //- Addressing of the refill
+    for (int i = 0; i < n; ++i)
+    {
+        forAll(structure[i], j)
+        {
+            row_.push_back(i);
+            col_.push_back(j);
+            chemistryAddr_.push_back(dwdc_.find(i, j));
+            reactorAddr_.push_back(structure_.find(i, j));
+        }
+
+        colTAddr_.push_back(structure_.find(i, n));
+    }
+
+    for (int j = 0; j <= n; ++j)
+    {
+        rowTAddr_.push_back(structure_.find(n, j));
+    }
+
+    if (exact_)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                denseAddr_.push_back(structure_.find(i, j));
+            }
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::HomogeneousReactor::~HomogeneousReactor()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+int TKC::HomogeneousReactor::nEqns() const
+{
+    return nSpecies_ + 1;
+}
+
+
+TKC::scalar TKC::HomogeneousReactor::update(const scalarField& y) const
+{
+    const scalar rho = concentrations(y, c_);
+
+    chemistry_.omega(y[nSpecies_], c_, omega_);
+
+    return rho;
+}
+
+
+TKC::scalar TKC::HomogeneousReactor::concentrations
+(
+    const scalarField& y,
+    scalarField& c
+) const
+{
+    const scalar T = y[nSpecies_];
+
+    scalar sumYW{0};
+
+    for (int i = 0; i < nSpecies_; ++i)
+    {
+        sumYW += y[i] / W_[i];
+    }
+
+    //- Ideal gas, p/(RT) in [mol/m^3] to [mol/cm^3]
+    const scalar rho = 1e-6*p_ / (Constants::R*T*sumYW);
+
+    c.resize(nSpecies_);
+
+    for (int i = 0; i < nSpecies_; ++i)
+    {
+        c[i] = rho*y[i] / W_[i];
+    }
+
+    return rho;
+}
+
+
+void TKC::HomogeneousReactor::derivatives
+(
+    const scalar,
+    const scalarField& y,
+    scalarField& dydt
+) const
+{
+    const int n = nSpecies_;
+    const scalar T = y[n];
+
+    const scalar rho = update(y);
+
+    const ThermoTable& table = chemistry_.thermoTable(T);
+    const scalarField& cpR = table.cpR();
+    const scalarField& hRT = table.hRT();
+
+    scalar cp{0};
+    scalar hw{0};
+
+    for (int i = 0; i < n; ++i)
+    {
+        cp += y[i]*cpR[i] / W_[i];
+        hw += hRT[i]*omega_[i];
+
+        dydt[i] = W_[i]*omega_[i] / rho;
+    }
+
+    //- R T and R cancel out, cp in [J/g/K]
+    dydt[n] = -hw*T / (rho*cp);
+}
+
+
+void TKC::HomogeneousReactor::jacobian
+(
+    const scalar t,
+    const scalarField& y,
+    scalarField& dydt,
+    SparseMatrix& J
+) const
+{
+    const int n = nSpecies_;
+    const scalar T = y[n];
+    const scalar R = Constants::R;
+
+    derivatives(t, y, dydt);
+
+    const scalar rho = update(y);
+
+    chemistry_.jacobian(T, c_, dwdc_, dwdT_);
+
+    const ThermoTable& table = chemistry_.thermoTable(T);
+    const scalarField& cpR = table.cpR();
+    const scalarField& hRT = table.hRT();
+    const scalarField& dcpRdT = table.dcpRdT();
+
+    //- Mass specific heat capacity [J/g/K] and its temperature derivative
+    scalar cp{0};
+    scalar dcpdT{0};
+
+    for (int i = 0; i < n; ++i)
+    {
+        cp += R*y[i]*cpR[i] / W_[i];
+        dcpdT += R*y[i]*dcpRdT[i] / W_[i];
+    }
+
+    const scalar dTdt = dydt[n];
+
+    //- d(omega)/dT at constant p and Y: c ~ 1/T
+    dwdc_.multiply(c_, dwdcC_);
+
+    for (int i = 0; i < n; ++i)
+    {
+        dwdT_[i] -= dwdcC_[i] / T;
+    }
+
+    J.reset();
+
+    scalarField& values = J.values();
+    const scalarField& dwdc = dwdc_.values();
+
+    //- Species block and sum_i h_i d(omega_i)/d(c_j)
+    std::fill(hSum_.begin(), hSum_.end(), 0);
+
+    forEach(row_, k)
+    {
+        const int i = row_[k];
+        const int j = col_[k];
+        const scalar Jc = dwdc[chemistryAddr_[k]];
+
+        values[reactorAddr_[k]] += W_[i]/W_[j]*Jc;
+
+        hSum_[j] += hRT[i]*R*T*Jc;
+    }
+
+    //- Density coupling, d(rho)/d(Y_j) = -rho W/W_j with the mean
+    //  molecular weight W; changes c and 1/rho of all species
+    if (exact_)
+    {
+        scalar sumYW{0};
+        scalar hc{0};
+
+        for (int i = 0; i < n; ++i)
+        {
+            sumYW += y[i] / W_[i];
+            hc += hRT[i]*R*T*dwdcC_[i];
+        }
+
+        const scalar Wmean = 1/sumYW;
+
+        for (int i = 0; i < n; ++i)
+        {
+            const scalar u = W_[i]*(omega_[i] - dwdcC_[i])/rho;
+
+            for (int j = 0; j < n; ++j)
+            {
+                values[denseAddr_[i*n + j]] += u*Wmean/W_[j];
+            }
+        }
+
+        for (int j = 0; j < n; ++j)
+        {
+            values[rowTAddr_[j]] += (hc/(rho*cp) + dTdt)*Wmean/W_[j];
+        }
+    }
+
+    //- Temperature column and row
+    scalar dTdotdT{0};
+
+    for (int i = 0; i < n; ++i)
+    {
+        const scalar h = hRT[i]*R*T;
+
+        values[colTAddr_[i]] += W_[i]/rho*dwdT_[i] + dydt[i]/T;
+
+        values[rowTAddr_[i]] +=
+            -hSum_[i]/(cp*W_[i]) - dTdt*R*cpR[i]/(W_[i]*cp);
+
+        dTdotdT -= R*cpR[i]*omega_[i] + h*dwdT_[i];
+    }
+
+    values[rowTAddr_[n]] += dTdotdT/(rho*cp) + dTdt/T - dTdt*dcpdT/cp;
+}
+
+
+const TKC::SparseMatrix& TKC::HomogeneousReactor::jacobianStructure() const
+{
+    return structure_;
+}
+
+
+TKC::scalarField TKC::HomogeneousReactor::state
+(
+    const scalar T,
+    const map<word, scalar>& composition,
+    const word mode
+) const
+{
+    scalarField y(nSpecies_ + 1, 0);
+
+    const wordList& species = chemistry_.species();
+
+    scalar sum{0};
+
+    loopMapConst(s, value, composition)
+    {
+        const auto it = std::find(species.begin(), species.end(), s);
+
+        if (it == species.end())
+        {
+            ErrorMsg
+            (
+                "The species " + s + " of the initial composition is not "
+                "included in the chemistry",
+                __FILE__,
+                __LINE__
+            );
+        }
+
+        const int i = it - species.begin();
+
+        //- Mass fractions are proportional to X_i W_i and c_i W_i
+        y[i] = (mode == "mass") ? value : value*W_[i];
+
+        sum += y[i];
+    }
+
+    if (sum <= 0)
+    {
+        ErrorMsg
+        (
+            "No initial composition of the reactor is given",
+            __FILE__,
+            __LINE__
+        );
+    }
+
+    for (int i = 0; i < nSpecies_; ++i)
+    {
+        y[i] /= sum;
+    }
+
+    y[nSpecies_] = T;
+
+    return y;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+TKC::scalar TKC::HomogeneousReactor::p() const
+{
+    return p_;
+}
+
+
+const TKC::scalarField& TKC::HomogeneousReactor::W() const
+{
+    return W_;
+}
+
+
+// ************************************************************************* //
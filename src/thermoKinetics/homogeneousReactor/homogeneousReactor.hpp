@@ -0,0 +1,208 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::HomogeneousReactor
+
+Description
+    Adiabatic, ideal homogeneous reactor at constant pressure as ODESystem.
+    The state y = (Y_0 ... Y_n-1, T) consists of the mass fractions of the
+    chemistry species (ordered by species ID) and the temperature [K]:
+
+        dY_i/dt = W_i omega_i / rho
+        dT/dt = - sum_i h_i omega_i / (rho cp)
+
+    with the source terms omega_i [mol/cm^3/s] of the concentrations
+    c_i = rho Y_i / W_i [mol/cm^3], the density rho [g/cm^3] of the ideal
+    gas, the molar enthalpies h_i [J/mol] and the mass specific heat
+    capacity cp [J/g/K] of the mixture.
+
+    The Jacobian is built out of the analytical, sparse d(omega)/d(c) of the
+    chemistry; the temperature row and column are dense (including the
+    temperature derivative of cp). The change of the density with the
+    composition couples all species (rank one, dense) and is only included
+    on request (exact Jacobian):
+
+    + sparse: sufficient for the Newton iterations of BDF, also for large
+      mechanisms
+    + exact: needed by the Rosenbrock methods, which lose their order
+      with an approximated Jacobian
+
+SourceFiles
+    homogeneousReactor.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef HomogeneousReactor_hpp
+#define HomogeneousReactor_hpp
+
+#include "definitions.hpp"
+#include "odeSystem.hpp"
+#include "chemistryCalc.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                      Class HomogeneousReactor Declaration
+\*---------------------------------------------------------------------------*/
+
+class HomogeneousReactor
+:
+    public ODESystem
+{
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Number of species
+            int nSpecies_;
+
+            //- Pressure [Pa]
+            scalar p_;
+
+            //- Molecular weights [g/mol]
+            scalarField W_;
+
+            //- Include the density coupling (exact, dense Jacobian)
+            bool exact_;
+
+            //- Structure of the Jacobian (species + temperature)
+            SparseMatrix structure_;
+
+
+        // Addressing
+
+            //- Entries (i,j) of d(omega)/d(c)
+            List<int> row_;
+            List<int> col_;
+
+            //- Positions of the entries in d(omega)/d(c) and in the
+            //  Jacobian of the reactor
+            List<int> chemistryAddr_;
+            List<int> reactorAddr_;
+
+            //- Positions of the temperature column (i,T) and row (T,j)
+            List<int> colTAddr_;
+            List<int> rowTAddr_;
+
+            //- Positions of the dense species block (exact only)
+            List<int> denseAddr_;
+
+
+        // Workspace
+
+            mutable scalarField c_;
+            mutable scalarField omega_;
+            mutable scalarField dwdT_;
+            mutable scalarField dwdcC_;
+            mutable scalarField hSum_;
+            mutable SparseMatrix dwdc_;
+
+
+        // Private Member Functions
+
+            //- Calculate the density rho [g/cm^3], the concentrations c_
+            //  and the source terms omega_ for the state y
+            scalar update(const scalarField&) const;
+
+
+    public:
+
+        //- Constructor with the pressure [Pa], optionally with the exact
+        //  (dense) Jacobian
+        HomogeneousReactor
+        (
+            const ChemistryCalc&,
+            const scalar,
+            const bool exact = false
+        );
+
+        //- Destructor
+        ~HomogeneousReactor();
+
+
+        // Member Functions
+
+            //- Return the number of equations (species + temperature)
+            int nEqns() const;
+
+            //- Calculate the derivatives dy/dt
+            void derivatives
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&
+            ) const;
+
+            //- Calculate the derivatives dy/dt and the Jacobian
+            void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&,
+                SparseMatrix&
+            ) const;
+
+            //- Return the structure of the Jacobian
+            const SparseMatrix& jacobianStructure() const;
+
+            //- Calculate the concentrations [mol/cm^3] of the state y;
+            //  returns the density rho [g/cm^3]
+            scalar concentrations(const scalarField&, scalarField&) const;
+
+            //- Build the state y out of the temperature [K] and the
+            //  composition given as "mole" or "mass" fraction or as
+            //  "concentration" (normalized)
+            scalarField state
+            (
+                const scalar,
+                const map<word, scalar>&,
+                const word
+            ) const;
+
+
+        // Return Functions
+
+            //- Return the pressure [Pa]
+            scalar p() const;
+
+            //- Return the molecular weights [g/mol]
+            const scalarField& W() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // HomogeneousReactor_hpp included
+
+// ************************************************************************* //
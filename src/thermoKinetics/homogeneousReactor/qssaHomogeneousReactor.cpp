@@ -0,0 +1,261 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "qssaHomogeneousReactor.hpp"
+#include "constants.hpp"
+#include "thermo.hpp"
+#include <math.h>
+#include <limits>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::QSSAHomogeneousReactor::QSSAHomogeneousReactor
+(
+    const ChemistryCalc& chemistry,
+    const ChemistryQSSA& qssa,
+    const scalar p
+)
+:
+    chemistry_(chemistry),
+    qssa_(qssa),
+    nSpecies_(chemistry.mechanism().nSpecies()),
+    nActive_(qssa.active().size()),
+    p_(p),
+    W_(nSpecies_),
+    c_(nSpecies_, 0),
+    omega_(nSpecies_),
+    yh_(nActive_ + 1),
+    dydth_(nActive_ + 1)
+{
+    const wordList& species = chemistry_.species();
+
+    const Thermo thermo = chemistry_.thermo();
+
+    forEach(species, i)
+    {
+        W_[i] = thermo.MW(species[i]);
+    }
+
+    //- Dense structure
+    const int n = nEqns();
+
+    List<List<int>> pattern(n);
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            pattern[i].push_back(j);
+        }
+    }
+
+    structure_ = SparseMatrix(pattern);
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            addr_.push_back(structure_.find(i, j));
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::QSSAHomogeneousReactor::~QSSAHomogeneousReactor()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+int TKC::QSSAHomogeneousReactor::nEqns() const
+{
+    return nActive_ + 1;
+}
+
+
+TKC::scalar TKC::QSSAHomogeneousReactor::update(const scalarField& y) const
+{
+    const List<int>& active = qssa_.active();
+
+    const scalar T = y[nActive_];
+
+    scalar sumYW{0};
+
+    forEach(active, k)
+    {
+        sumYW += y[k] / W_[active[k]];
+    }
+
+    //- Ideal gas, p/(RT) in [mol/m^3] to [mol/cm^3]
+    const scalar rho = 1e-6*p_ / (Constants::R*T*sumYW);
+
+    forEach(active, k)
+    {
+        c_[active[k]] = rho*y[k] / W_[active[k]];
+    }
+
+    //- Updates the QSS concentrations in c_, omega of them is zero
+    qssa_.omega(T, c_, omega_);
+
+    return rho;
+}
+
+
+void TKC::QSSAHomogeneousReactor::derivatives
+(
+    const scalar,
+    const scalarField& y,
+    scalarField& dydt
+) const
+{
+    const List<int>& active = qssa_.active();
+
+    const int n = nActive_;
+    const scalar T = y[n];
+
+    const scalar rho = update(y);
+
+    const ThermoTable& table = chemistry_.thermoTable(T);
+    const scalarField& cpR = table.cpR();
+    const scalarField& hRT = table.hRT();
+
+    scalar cp{0};
+    scalar hw{0};
+
+    forEach(active, k)
+    {
+        const int s = active[k];
+
+        cp += y[k]*cpR[s] / W_[s];
+        hw += hRT[s]*omega_[s];
+
+        dydt[k] = W_[s]*omega_[s] / rho;
+    }
+
+    //- R T and R cancel out, cp in [J/g/K]
+    dydt[n] = -hw*T / (rho*cp);
+}
+
+
+void TKC::QSSAHomogeneousReactor::jacobian
+(
+    const scalar t,
+    const scalarField& y,
+    scalarField& dydt,
+    SparseMatrix& J
+) const
+{
+    const int n = nEqns();
+
+    //- Converge the QSS concentrations of the state; the reference and
+    //  the perturbed derivatives start from these values
+    derivatives(t, y, dydt);
+
+    const scalarField c0(c_);
+
+    derivatives(t, y, dydt);
+
+    J.reset();
+
+    scalarField& values = J.values();
+
+    //- The derivatives are only accurate to the tolerance of the QSSA
+    const scalar delta =
+        sqrt
+        (
+            max
+            (
+                std::numeric_limits<scalar>::epsilon(),
+                qssa_.tolerance()
+            )
+        );
+
+    yh_ = y;
+
+    for (int j = 0; j < n; ++j)
+    {
+        const scalar h = delta*max(abs(y[j]), scalar(1e-6));
+
+        yh_[j] = y[j] + h;
+        c_ = c0;
+
+        derivatives(t, yh_, dydth_);
+
+        for (int i = 0; i < n; ++i)
+        {
+            values[addr_[i*n + j]] = (dydth_[i] - dydt[i]) / h;
+        }
+
+        yh_[j] = y[j];
+    }
+
+    c_ = c0;
+}
+
+
+const TKC::SparseMatrix&
+TKC::QSSAHomogeneousReactor::jacobianStructure() const
+{
+    return structure_;
+}
+
+
+TKC::scalarField TKC::QSSAHomogeneousReactor::state
+(
+    const scalarField& y
+) const
+{
+    const List<int>& active = qssa_.active();
+
+    scalarField z(nActive_ + 1);
+
+    forEach(active, k)
+    {
+        z[k] = y[active[k]];
+    }
+
+    z[nActive_] = y.back();
+
+    return z;
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+TKC::scalar TKC::QSSAHomogeneousReactor::p() const
+{
+    return p_;
+}
+
+
+const TKC::scalarField& TKC::QSSAHomogeneousReactor::c() const
+{
+    return c_;
+}
+
+
+// ************************************************************************* //
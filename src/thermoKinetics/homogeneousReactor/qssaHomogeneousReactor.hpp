@@ -0,0 +1,183 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::QSSAHomogeneousReactor
+
+Description
+    Adiabatic, ideal homogeneous reactor at constant pressure (see
+    HomogeneousReactor) reduced by the quasi-steady-state approximation
+    (see ChemistryQSSA). The state y = (Y_a ... , T) only consists of the
+    mass fractions of the integrated species a (ChemistryQSSA::active())
+    and the temperature [K]. The concentrations of the QSS species are
+    calculated algebraically out of the integrated species in each
+    evaluation; their mass is neglected in the density:
+
+        dY_a/dt = W_a omega_a / rho
+        dT/dt = - sum_a h_a omega_a / (rho cp)
+
+    The QSS concentrations couple all species, hence the Jacobian is dense
+    and built by forward finite differences of the derivatives (including
+    the change of the QSS concentrations). The Gauss-Seidel iterations of
+    the QSSA start from the last solution; for the finite differences all
+    evaluations start from the same values and the step is based on the
+    tolerance of the QSSA, which limits the accuracy of the derivatives.
+
+SourceFiles
+    qssaHomogeneousReactor.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef QSSAHomogeneousReactor_hpp
+#define QSSAHomogeneousReactor_hpp
+
+#include "definitions.hpp"
+#include "odeSystem.hpp"
+#include "chemistryCalc.hpp"
+#include "chemistryQSSA.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+/*---------------------------------------------------------------------------*\
+                    Class QSSAHomogeneousReactor Declaration
+\*---------------------------------------------------------------------------*/
+
+class QSSAHomogeneousReactor
+:
+    public ODESystem
+{
+    private:
+
+        // Private Data
+
+            //- Reference to the chemistry
+            const ChemistryCalc& chemistry_;
+
+            //- Reference to the QSSA (QSS and integrated species)
+            const ChemistryQSSA& qssa_;
+
+            //- Number of species
+            int nSpecies_;
+
+            //- Number of integrated species
+            int nActive_;
+
+            //- Pressure [Pa]
+            scalar p_;
+
+            //- Molecular weights of all species [g/mol]
+            scalarField W_;
+
+            //- Dense structure of the Jacobian
+            SparseMatrix structure_;
+
+            //- Positions of the entries (i,j) in the Jacobian, row by row
+            List<int> addr_;
+
+
+        // Workspace
+
+            //- Concentrations of all species, the QSS entries are the start
+            //  values of the next Gauss-Seidel iterations
+            mutable scalarField c_;
+            mutable scalarField omega_;
+            mutable scalarField yh_;
+            mutable scalarField dydth_;
+
+
+        // Private Member Functions
+
+            //- Calculate the density rho [g/cm^3], the concentrations c_
+            //  (incl. the QSS species) and the source terms omega_ for the
+            //  state y
+            scalar update(const scalarField&) const;
+
+
+    public:
+
+        //- Constructor with the QSSA and the pressure [Pa]
+        QSSAHomogeneousReactor
+        (
+            const ChemistryCalc&,
+            const ChemistryQSSA&,
+            const scalar
+        );
+
+        //- Destructor
+        ~QSSAHomogeneousReactor();
+
+
+        // Member Functions
+
+            //- Return the number of equations (integrated species +
+            //  temperature)
+            int nEqns() const;
+
+            //- Calculate the derivatives dy/dt
+            void derivatives
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&
+            ) const;
+
+            //- Calculate the derivatives dy/dt and the Jacobian
+            void jacobian
+            (
+                const scalar,
+                const scalarField&,
+                scalarField&,
+                SparseMatrix&
+            ) const;
+
+            //- Return the structure of the Jacobian
+            const SparseMatrix& jacobianStructure() const;
+
+            //- Build the reduced state out of the state (Y_0 ... Y_n-1, T)
+            //  of the HomogeneousReactor
+            scalarField state(const scalarField&) const;
+
+
+        // Return Functions
+
+            //- Return the pressure [Pa]
+            scalar p() const;
+
+            //- Return the concentrations of all species of the last
+            //  evaluation (incl. the QSS species) [mol/cm^3]
+            const scalarField& c() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // QSSAHomogeneousReactor_hpp included
+
+// ************************************************************************* //
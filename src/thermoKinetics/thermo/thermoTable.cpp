@@ -0,0 +1,209 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+\*---------------------------------------------------------------------------*/
+
+#include "thermoTable.hpp"
+#include "thermoCalc.hpp"
+#include <math.h>
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+TKC::ThermoTable::ThermoTable()
+{}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+TKC::ThermoTable::~ThermoTable()
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void TKC::ThermoTable::build
+(
+    const ThermoCalc& thermo,
+    const wordList& species
+)
+{
+    nSpecies_ = species.size();
+
+    TL_.assign(nSpecies_, 0);
+    TC_.assign(nSpecies_, 0);
+    TH_.assign(nSpecies_, 0);
+    coeffsLT_.assign(7*nSpecies_, 0);
+    coeffsHT_.assign(7*nSpecies_, 0);
+
+    forEach(species, s)
+    {
+        const word& name = species[s];
+
+        TL_[s] = thermo.LT(name);
+        TC_[s] = thermo.CT(name);
+        TH_[s] = thermo.HT(name);
+
+        const List<scalar> LT = thermo.NASACoeffsLT(name);
+        const List<scalar> HT = thermo.NASACoeffsHT(name);
+
+        for (int i = 0; i < 7; ++i)
+        {
+            coeffsLT_[7*s+i] = LT[i];
+            coeffsHT_[7*s+i] = HT[i];
+        }
+    }
+
+    cpR_.assign(nSpecies_, 0);
+    hRT_.assign(nSpecies_, 0);
+    sR_.assign(nSpecies_, 0);
+    gRT_.assign(nSpecies_, 0);
+    dcpRdT_.assign(nSpecies_, 0);
+
+    //- Force the evaluation at the next update
+    T_ = -1;
+}
+
+
+void TKC::ThermoTable::update(const scalar T)
+{
+    if (T == T_)
+    {
+        return;
+    }
+
+    T_ = T;
+
+    //- Powers of T are calculated once for all species
+    const scalar T2 = T*T;
+    const scalar T3 = T2*T;
+    const scalar T4 = T3*T;
+    const scalar lnT = log(T);
+    const scalar rT = 1/T;
+
+    for (int s = 0; s < nSpecies_; ++s)
+    {
+        //- Same range selection as ThermoCalc::whichTempRange
+        const bool highTemp = (T > TH_[s]) || (T >= TL_[s] && T > TC_[s]);
+
+        const scalar* a =
+            highTemp ? &coeffsHT_[7*s] : &coeffsLT_[7*s];
+
+        cpR_[s] = a[0] + a[1]*T + a[2]*T2 + a[3]*T3 + a[4]*T4;
+
+        hRT_[s] =
+            a[0] + a[1]*T/2 + a[2]*T2/3 + a[3]*T3/4 + a[4]*T4/5 + a[5]*rT;
+
+        sR_[s] =
+            a[0]*lnT + a[1]*T + a[2]*T2/2 + a[3]*T3/3 + a[4]*T4/4 + a[6];
+
+        gRT_[s] = hRT_[s] - sR_[s];
+
+        dcpRdT_[s] = a[1] + 2*a[2]*T + 3*a[3]*T2 + 4*a[4]*T3;
+    }
+}
+
+
+void TKC::ThermoTable::gRT
+(
+    const int s,
+    const scalarField& T,
+    const scalarField& lnT,
+    scalarField& gRT
+) const
+{
+    const scalar* aL = &coeffsLT_[7*s];
+    const scalar* aH = &coeffsHT_[7*s];
+
+    const scalar TL = TL_[s];
+    const scalar TC = TC_[s];
+    const scalar TH = TH_[s];
+
+    gRT.resize(T.size());
+
+    //- Loop over the states, the range selection is branch free
+    forEach(T, n)
+    {
+        const scalar t = T[n];
+
+        const bool highTemp = (t > TH) || (t >= TL && t > TC);
+
+        const scalar* a = highTemp ? aH : aL;
+
+        const scalar hRT =
+            a[0] + a[1]*t/2 + a[2]*t*t/3 + a[3]*t*t*t/4 + a[4]*t*t*t*t/5
+          + a[5]/t;
+
+        const scalar sR =
+            a[0]*lnT[n] + a[1]*t + a[2]*t*t/2 + a[3]*t*t*t/3
+          + a[4]*t*t*t*t/4 + a[6];
+
+        gRT[n] = hRT - sR;
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Return Functions  * * * * * * * * * * * * * //
+
+int TKC::ThermoTable::nSpecies() const
+{
+    return nSpecies_;
+}
+
+
+TKC::scalar TKC::ThermoTable::T() const
+{
+    return T_;
+}
+
+
+const TKC::scalarField& TKC::ThermoTable::cpR() const
+{
+    return cpR_;
+}
+
+
+const TKC::scalarField& TKC::ThermoTable::hRT() const
+{
+    return hRT_;
+}
+
+
+const TKC::scalarField& TKC::ThermoTable::sR() const
+{
+    return sR_;
+}
+
+
+const TKC::scalarField& TKC::ThermoTable::gRT() const
+{
+    return gRT_;
+}
+
+
+const TKC::scalarField& TKC::ThermoTable::dcpRdT() const
+{
+    return dcpRdT_;
+}
+
+
+// ************************************************************************* //
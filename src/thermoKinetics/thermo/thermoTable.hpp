@@ -0,0 +1,153 @@
+/*---------------------------------------------------------------------------*\
+  c-o-o-c-o-o-o             |
+  |     |     T hermo       | Open Source Thermo-Kinetic Library
+  c-o-o-c     K iknetic     |
+  |     |     C onstructor  | Copyright (C) 2020 Holzmann CFD
+  c     c-o-o-o             |
+-------------------------------------------------------------------------------
+License
+    This file is part of Automatic Flamelet Constructor.
+
+    TKC is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the
+    Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    TKC is distributed in the hope that it will be useful, but
+    WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with TKC; if not, see <http://www.gnu.org/licenses/>
+
+Class
+    TKC::ThermoTable
+
+Description
+    Species level thermo workspace. The NASA coefficients of a given species
+    list (e.g. the chemistry species) are copied once into flat fields
+    (7 coefficients per species). For a temperature T all dimensionless
+    standard state properties are evaluated once for all species:
+
+    \f[ \frac{c_p}{R},\quad \frac{h}{RT},\quad \frac{s^0}{R},\quad
+        \frac{g^0}{RT} = \frac{h}{RT} - \frac{s^0}{R},\quad
+        \frac{1}{R}\frac{d c_p}{d T} \f]
+
+    The values are kept until another temperature is requested. The
+    pressure correction of the entropy is not included (p0 state).
+
+SourceFiles
+    thermoTable.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef ThermoTable_hpp
+#define ThermoTable_hpp
+
+#include "definitions.hpp"
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+namespace TKC
+{
+
+class ThermoCalc;
+
+/*---------------------------------------------------------------------------*\
+                         Class ThermoTable Declaration
+\*---------------------------------------------------------------------------*/
+
+class ThermoTable
+{
+    private:
+
+        // Private data
+
+            //- Number of species
+            int nSpecies_{0};
+
+            //- Temperature limits of the NASA polynomials
+            scalarField TL_;
+            scalarField TC_;
+            scalarField TH_;
+
+            //- NASA coefficients, 7 per species
+            scalarField coeffsLT_;
+            scalarField coeffsHT_;
+
+            //- Temperature of the stored values, negative if none
+            scalar T_{-1};
+
+            //- Dimensionless properties for T_
+            scalarField cpR_;
+            scalarField hRT_;
+            scalarField sR_;
+            scalarField gRT_;
+            scalarField dcpRdT_;
+
+
+    public:
+
+        //- Constructor
+        ThermoTable();
+
+        //- Destructor
+        ~ThermoTable();
+
+
+        // Member Functions
+
+            //- Copy the NASA coefficients of the species list
+            void build(const ThermoCalc&, const wordList&);
+
+            //- Evaluate all species for temperature T (skipped if the
+            //  values for T are already available)
+            void update(const scalar);
+
+            //- Evaluate g0/(RT) of species s for N temperatures at once
+            //  (T and ln(T) given per state, e.g. per CFD cell); the stored
+            //  values are not touched
+            void gRT
+            (
+                const int,
+                const scalarField&,
+                const scalarField&,
+                scalarField&
+            ) const;
+
+
+        // Return Functions
+
+            //- Return number of species
+            int nSpecies() const;
+
+            //- Return the temperature of the stored values
+            scalar T() const;
+
+            //- Return cp/R [-]
+            const scalarField& cpR() const;
+
+            //- Return h/(RT) [-]
+            const scalarField& hRT() const;
+
+            //- Return s0/R [-]
+            const scalarField& sR() const;
+
+            //- Return g0/(RT) [-]
+            const scalarField& gRT() const;
+
+            //- Return d(cp/R)/dT [1/K]
+            const scalarField& dcpRdT() const;
+};
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+} // End namespace TKC
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+#endif // ThermoTable_hpp included
+
+// ************************************************************************* //
@@ -28,6 +28,7 @@ License
 #include "matrix.hpp"
 #include "vector.hpp"
 #include <math.h>
+#include <utility>
 
 // * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
 
@@ -296,7 +297,6 @@ TKC::scalar TKC::TransportCalc::viscosityPolynomial
 
 void TKC::TransportCalc::fitViscosity()
 {
-    //- TODO use one function instead of 3
     //- Species from chemistry
     const wordList& species = chemistrySpecies();
 
@@ -328,115 +328,114 @@ void TKC::TransportCalc::fitViscosity()
             mu.push_back(log(viscosity(s, Tv)));
         }
 
-        //- Fitting
-        //  This could be done more beatuiful with objects
-        //
-        //  Polynom: ln(mu) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
-        //  f1(T) = ln(T)^3
-        //  f2(T) = ln(T)^2
-        //  f3(T) = ln(T)
-        //  f4(T) = 1
-
-        //- Now we need to build a matrix A that looks like
-        //          1             2             3             4          5
-        //1 | [f1(T)f1(T)]  [f1(T)f2(T)]  [f1(T)f3(T)]  [f1(T)f4(T)] [yf1(T)] |
-        //2 | [f2(T)f1(T)]  [f2(T)f2(T)]  [f2(T)f3(T)]  [f2(T)f4(T)] [yf1(T)] |
-        //3 | [f3(T)f1(T)]  [f3(T)f2(T)]  [f3(T)f3(T)]  [f3(T)f4(T)] [yf1(T)] |
-        //4 | [f4(T)f1(T)]  [f4(T)f2(T)]  [f4(T)f3(T)]  [f4(T)f4(T)] [yf1(T)] |
-        //
-        //  [] means gauss summation; y = mu value
-        //  Matrix is symmetric in case of the first 4 rows and cols
-        scalar gS_11{0};
-        scalar gS_12{0};
-        scalar gS_13{0};
-        scalar gS_14{0};
-        scalar gS_15{0};
-
-        scalar gS_22{0};
-        scalar gS_23{0};
-        scalar gS_24{0};
-        scalar gS_25{0};
-
-        scalar gS_33{0};
-        scalar gS_34{0};
-        scalar gS_35{0};
-
-        scalar gS_44{0};
-        scalar gS_45{0};
-
-        //- a) Calculate the gauss summations
-        for (size_t j = 0; j < n; ++j)
+        //- Fitting of the polynomial (least squares)
+        //  ln(mu) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
+        const Vector x = fitPolynomial(T, mu);
+
+        //- Assign the values
+        viscosityPolyCoeffs(s, x);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Fitting  * * * * * * * * * * * * * * * * //
+
+TKC::Vector TKC::TransportCalc::fitPolynomial
+(
+    const scalarField& T,
+    const scalarField& y
+) const
+{
+    //- Least squares fit of the polynomial
+    //  y = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
+    //  f1(T) = ln(T)^3
+    //  f2(T) = ln(T)^2
+    //  f3(T) = ln(T)
+    //  f4(T) = 1
+    //
+    //  Normal equations; the augmented matrix looks like
+    //          1             2             3             4          5
+    //1 | [f1(T)f1(T)]  [f1(T)f2(T)]  [f1(T)f3(T)]  [f1(T)f4(T)] [yf1(T)] |
+    //2 | [f2(T)f1(T)]  [f2(T)f2(T)]  [f2(T)f3(T)]  [f2(T)f4(T)] [yf2(T)] |
+    //3 | [f3(T)f1(T)]  [f3(T)f2(T)]  [f3(T)f3(T)]  [f3(T)f4(T)] [yf3(T)] |
+    //4 | [f4(T)f1(T)]  [f4(T)f2(T)]  [f4(T)f3(T)]  [f4(T)f4(T)] [yf4(T)] |
+    //
+    //  [] means gauss summation. The system is badly conditioned (powers
+    //  of ln(T) up to 6), hence it is always solved in highScalar,
+    //  independent of the precision of scalar
+    const int n{4};
+
+    highScalar A[n][n+1] = {};
+
+    forEach(T, j)
+    {
+        const highScalar lnT = log(highScalar(T[j]));
+
+        const highScalar f[n] = {lnT*lnT*lnT, lnT*lnT, lnT, 1};
+
+        for (int r = 0; r < n; ++r)
         {
-            // Temperature value
-            const scalar& Tv = T[j];
-            const scalar& muv = mu[j];
-
-            gS_11 += pow(log(Tv), 3) * pow(log(Tv), 3);
-            gS_12 += pow(log(Tv), 3) * pow(log(Tv), 2);
-            gS_13 += pow(log(Tv), 3) * pow(log(Tv), 1);
-            gS_14 += pow(log(Tv), 3) * 1;
-            gS_15 += muv * pow(log(Tv), 3);
-
-            gS_22 += pow(log(Tv), 2) * pow(log(Tv), 2);
-            gS_23 += pow(log(Tv), 2) * pow(log(Tv), 1);
-            gS_24 += pow(log(Tv), 2) * 1;
-            gS_25 += muv * pow(log(Tv), 2);
-
-            gS_33 += pow(log(Tv), 1) * pow(log(Tv), 1);
-            gS_34 += pow(log(Tv), 1) * 1;
-            gS_35 += muv * pow(log(Tv), 1);
-
-            gS_44 += 1 * 1;
-            gS_45 += muv * 1;
+            for (int c = 0; c < n; ++c)
+            {
+                A[r][c] += f[r]*f[c];
+            }
+
+            A[r][n] += highScalar(y[j])*f[r];
         }
+    }
 
-        //- b) Assign the values to the matrix A
-        Matrix A(4,4);
-
-        A(0,0,gS_11);
-        A(0,1,gS_12);
-        A(0,2,gS_13);
-        A(0,3,gS_14);
-
-        //- A_21 = A_12
-        A(1,0,gS_12);
-        A(1,1,gS_22);
-        A(1,2,gS_23);
-        A(1,3,gS_24);
-
-        //  A_31 = A_13
-        //  A_32 = A_23
-        A(2,0,gS_13);
-        A(2,1,gS_23);
-        A(2,2,gS_33);
-        A(2,3,gS_34);
-
-        //  A_41 = A_14
-        //  A_42 = A_24
-        //  A_43 = A_34
-        A(3,0,gS_14);
-        A(3,1,gS_24);
-        A(3,2,gS_34);
-        A(3,3,gS_44);
-
-        //- Calculate the inverse
-        Matrix AI = A.inverse();
-
-        //- Init the solution vector
-        Vector b(4);
-
-        b(0, gS_15);
-        b(1, gS_25);
-        b(2, gS_35);
-        b(3, gS_45);
-
-        //- Calculate the polynomial coefficients
-        //  x = b * A^-1
-        const Vector x = b * AI;
+    //- Gauss elimination with partial pivoting
+    for (int r = 0; r < n; ++r)
+    {
+        int pivot = r;
 
-        //- Assign the values
-        viscosityPolyCoeffs(s, x);
+        for (int rr = r+1; rr < n; ++rr)
+        {
+            if (fabs(A[rr][r]) > fabs(A[pivot][r]))
+            {
+                pivot = rr;
+            }
+        }
+
+        for (int c = 0; c <= n; ++c)
+        {
+            std::swap(A[r][c], A[pivot][c]);
+        }
+
+        for (int rr = r+1; rr < n; ++rr)
+        {
+            const highScalar multiplicator = A[rr][r]/A[r][r];
+
+            for (int c = r; c <= n; ++c)
+            {
+                A[rr][c] -= multiplicator*A[r][c];
+            }
+        }
+    }
+
+    //- Back substitution
+    highScalar x[n];
+
+    for (int r = n-1; r >= 0; --r)
+    {
+        highScalar sum = A[r][n];
+
+        for (int c = r+1; c < n; ++c)
+        {
+            sum -= A[r][c]*x[c];
+        }
+
+        x[r] = sum/A[r][r];
     }
+
+    Vector coeffs(n);
+
+    for (int r = 0; r < n; ++r)
+    {
+        coeffs(r, scalar(x[r]));
+    }
+
+    return coeffs;
 }
 
 
@@ -704,111 +703,9 @@ void TKC::TransportCalc::fitThermalConductivity()
             );
         }
 
-        //- Fitting
-        //  This could be done more beatuiful with objects
-        //
-        //  Polynom: ln(lambda) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
-        //  f1(T) = ln(T)^3
-        //  f2(T) = ln(T)^2
-        //  f3(T) = ln(T)
-        //  f4(T) = 1
-
-        //- Now we need to build a matrix A that looks like
-        //          1             2             3             4          5
-        //1 | [f1(T)f1(T)]  [f1(T)f2(T)]  [f1(T)f3(T)]  [f1(T)f4(T)] [yf1(T)] |
-        //2 | [f2(T)f1(T)]  [f2(T)f2(T)]  [f2(T)f3(T)]  [f2(T)f4(T)] [yf1(T)] |
-        //3 | [f3(T)f1(T)]  [f3(T)f2(T)]  [f3(T)f3(T)]  [f3(T)f4(T)] [yf1(T)] |
-        //4 | [f4(T)f1(T)]  [f4(T)f2(T)]  [f4(T)f3(T)]  [f4(T)f4(T)] [yf1(T)] |
-        //
-        //  [] means gauss summation; y = lambda value
-        //  Matrix is symmetric in case of the first 4 rows and cols
-        scalar gS_11{0};
-        scalar gS_12{0};
-        scalar gS_13{0};
-        scalar gS_14{0};
-        scalar gS_15{0};
-
-        scalar gS_22{0};
-        scalar gS_23{0};
-        scalar gS_24{0};
-        scalar gS_25{0};
-
-        scalar gS_33{0};
-        scalar gS_34{0};
-        scalar gS_35{0};
-
-        scalar gS_44{0};
-        scalar gS_45{0};
-
-        //- a) Calculate the gauss summations
-        for (size_t j = 0; j < n; ++j)
-        {
-            // Temperature value
-            const scalar& Tv = T[j];
-            const scalar& lambdav = lambda[j];
-
-            gS_11 += pow(log(Tv), 3) * pow(log(Tv), 3);
-            gS_12 += pow(log(Tv), 3) * pow(log(Tv), 2);
-            gS_13 += pow(log(Tv), 3) * pow(log(Tv), 1);
-            gS_14 += pow(log(Tv), 3) * 1;
-            gS_15 += lambdav * pow(log(Tv), 3);
-
-            gS_22 += pow(log(Tv), 2) * pow(log(Tv), 2);
-            gS_23 += pow(log(Tv), 2) * pow(log(Tv), 1);
-            gS_24 += pow(log(Tv), 2) * 1;
-            gS_25 += lambdav * pow(log(Tv), 2);
-
-            gS_33 += pow(log(Tv), 1) * pow(log(Tv), 1);
-            gS_34 += pow(log(Tv), 1) * 1;
-            gS_35 += lambdav * pow(log(Tv), 1);
-
-            gS_44 += 1 * 1;
-            gS_45 += lambdav * 1;
-        }
-
-        //- b) Assign the values to the matrix A
-        Matrix A(4,4);
-
-        A(0,0,gS_11);
-        A(0,1,gS_12);
-        A(0,2,gS_13);
-        A(0,3,gS_14);
-
-        //- A_21 = A_12
-        A(1,0,gS_12);
-        A(1,1,gS_22);
-        A(1,2,gS_23);
-        A(1,3,gS_24);
-
-        //  A_31 = A_13
-        //  A_32 = A_23
-        A(2,0,gS_13);
-        A(2,1,gS_23);
-        A(2,2,gS_33);
-        A(2,3,gS_34);
-
-        //  A_41 = A_14
-        //  A_42 = A_24
-        //  A_43 = A_34
-        A(3,0,gS_14);
-        A(3,1,gS_24);
-        A(3,2,gS_34);
-        A(3,3,gS_44);
-
-        //- Calculate the inverse
-        Matrix AI = A.inverse();
-
-        //- Init the solution vector
-        Vector b(4);
-
-        b(0, gS_15);
-        b(1, gS_25);
-        b(2, gS_35);
-        b(3, gS_45);
-
-        //- Calculate the polynomial coefficients
-        //  x = b * A^-1
-        const Vector x = b * AI;
+        //- Fitting of the polynomial (least squares)
+        //  ln(lambda) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
+        const Vector x = fitPolynomial(T, lambda);
 
         //- Save the values
         thermalConductivityPolyCoeffs(s, x);
@@ -1049,111 +946,9 @@ void TKC::TransportCalc::fitBinaryDiffusivity()
                 );
             }
 
-            //- Fitting
-            //  This could be done more beatuiful with objects
-            //
-            //  Polynom: ln(Dij*p) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
-            //  f1(T) = ln(T)^3
-            //  f2(T) = ln(T)^2
-            //  f3(T) = ln(T)
-            //  f4(T) = 1
-
-            //- Now we need to build a matrix A that looks like
-            //          1             2             3             4          5
-            //1 | [f1(T)f1(T)]  [f1(T)f2(T)]  [f1(T)f3(T)]  [f1(T)f4(T)] [yf1(T)] |
-            //2 | [f2(T)f1(T)]  [f2(T)f2(T)]  [f2(T)f3(T)]  [f2(T)f4(T)] [yf1(T)] |
-            //3 | [f3(T)f1(T)]  [f3(T)f2(T)]  [f3(T)f3(T)]  [f3(T)f4(T)] [yf1(T)] |
-            //4 | [f4(T)f1(T)]  [f4(T)f2(T)]  [f4(T)f3(T)]  [f4(T)f4(T)] [yf1(T)] |
-            //
-            //  [] means gauss summation; y = ln(Dij*p) value
-            //  Matrix is symmetric in case of the first 4 rows and cols
-            scalar gS_11{0};
-            scalar gS_12{0};
-            scalar gS_13{0};
-            scalar gS_14{0};
-            scalar gS_15{0};
-
-            scalar gS_22{0};
-            scalar gS_23{0};
-            scalar gS_24{0};
-            scalar gS_25{0};
-
-            scalar gS_33{0};
-            scalar gS_34{0};
-            scalar gS_35{0};
-
-            scalar gS_44{0};
-            scalar gS_45{0};
-
-            //- a) Calculate the gauss summations
-            for (size_t j = 0; j < n; ++j)
-            {
-                // Temperature value
-                const scalar& Tv = T[j];
-                const scalar& Dijv = Dij[j];
-
-                gS_11 += pow(log(Tv), 3) * pow(log(Tv), 3);
-                gS_12 += pow(log(Tv), 3) * pow(log(Tv), 2);
-                gS_13 += pow(log(Tv), 3) * pow(log(Tv), 1);
-                gS_14 += pow(log(Tv), 3) * 1;
-                gS_15 += Dijv * pow(log(Tv), 3);
-
-                gS_22 += pow(log(Tv), 2) * pow(log(Tv), 2);
-                gS_23 += pow(log(Tv), 2) * pow(log(Tv), 1);
-                gS_24 += pow(log(Tv), 2) * 1;
-                gS_25 += Dijv * pow(log(Tv), 2);
-
-                gS_33 += pow(log(Tv), 1) * pow(log(Tv), 1);
-                gS_34 += pow(log(Tv), 1) * 1;
-                gS_35 += Dijv * pow(log(Tv), 1);
-
-                gS_44 += 1 * 1;
-                gS_45 += Dijv * 1;
-            }
-
-            //- b) Assign the values to the matrix A
-            Matrix A(4,4);
-
-            A(0,0,gS_11);
-            A(0,1,gS_12);
-            A(0,2,gS_13);
-            A(0,3,gS_14);
-
-            //- A_21 = A_12
-            A(1,0,gS_12);
-            A(1,1,gS_22);
-            A(1,2,gS_23);
-            A(1,3,gS_24);
-
-            //  A_31 = A_13
-            //  A_32 = A_23
-            A(2,0,gS_13);
-            A(2,1,gS_23);
-            A(2,2,gS_33);
-            A(2,3,gS_34);
-
-            //  A_41 = A_14
-            //  A_42 = A_24
-            //  A_43 = A_34
-            A(3,0,gS_14);
-            A(3,1,gS_24);
-            A(3,2,gS_34);
-            A(3,3,gS_44);
-
-            //- Calculate the inverse
-            Matrix AI = A.inverse();
-
-            //- Init the solution vector
-            Vector b(4);
-
-            b(0, gS_15);
-            b(1, gS_25);
-            b(2, gS_35);
-            b(3, gS_45);
-
-            //- Calculate the polynomial coefficients
-            //  x = b * A^-1
-            const Vector x = b * AI;
+            //- Fitting of the polynomial (least squares)
+            //  ln(Dij*p) = D ln(T)^3 + C ln(T)^2  + B ln(T) + A
+            const Vector x = fitPolynomial(T, Dij);
 
             //- Save the values
             binaryDiffusivityPolyCoeffs(s1, s2, x);
@@ -74,6 +74,13 @@ class TransportCalc
             scalar rho(const scalar, const scalar, const scalar) const;
 
 
+        // Fitting
+
+            //- Least squares fit of y = D ln(T)^3 + C ln(T)^2 + B ln(T) + A,
+            //  returns (D, C, B, A); solved in highScalar precision
+            Vector fitPolynomial(const scalarField&, const scalarField&) const;
+
+
         // Calculation functions for viscosity
 
             //- Kinetic calculation, pure species viscosity